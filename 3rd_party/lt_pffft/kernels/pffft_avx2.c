@@ -0,0 +1,3 @@
+/* float kernel for AVX2 and FMA, see pffft_kernels.h */
+#define PFFFT_KERNEL_SUFFIX _avx2
+#include "../pffft.c"
@@ -0,0 +1,3 @@
+/* float kernel for AVX-512, see pffft_kernels.h */
+#define PFFFT_KERNEL_SUFFIX _avx512
+#include "../pffft.c"
@@ -0,0 +1,3 @@
+/* float kernel for SSE (the x86-64 baseline), see pffft_kernels.h */
+#define PFFFT_KERNEL_SUFFIX _sse
+#include "../pffft.c"
@@ -0,0 +1,3 @@
+/* double kernel for AVX2 and FMA, see pffft_kernels.h */
+#define PFFFT_KERNEL_SUFFIX _avx2
+#include "../pffft_double.c"
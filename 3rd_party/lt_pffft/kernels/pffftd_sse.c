@@ -0,0 +1,3 @@
+/* double kernel for SSE2 (the x86-64 baseline), see pffft_kernels.h */
+#define PFFFT_KERNEL_SUFFIX _sse
+#include "../pffft_double.c"
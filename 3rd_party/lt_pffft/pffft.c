@@ -78,11 +78,13 @@
 #  define NEVER_INLINE(return_type) return_type __attribute__ ((noinline))
 #  define RESTRICT __restrict
 #  define VLA_ARRAY_ON_STACK(type__, varname__, size__) type__ varname__[size__];
+#  define UNROLL_LOOP _Pragma("GCC unroll 16")
 #elif defined(COMPILER_MSVC)
 #  define ALWAYS_INLINE(return_type) __forceinline return_type
 #  define NEVER_INLINE(return_type) __declspec(noinline) return_type
 #  define RESTRICT __restrict
 #  define VLA_ARRAY_ON_STACK(type__, varname__, size__) type__ *varname__ = (type__*)_alloca(size__ * sizeof(type__))
+#  define UNROLL_LOOP
 #endif
 
 
@@ -98,32 +100,44 @@
 #include "simd/pf_float.h"
 
 /* have code comparable with this definition */
-#define SETUP_STRUCT               PFFFT_Setup
-#define FUNC_NEW_SETUP             pffft_new_setup
-#define FUNC_DESTROY               pffft_destroy_setup
-#define FUNC_TRANSFORM_UNORDRD     pffft_transform
-#define FUNC_TRANSFORM_ORDERED     pffft_transform_ordered
-#define FUNC_ZREORDER              pffft_zreorder
-#define FUNC_ZCONVOLVE_ACCUMULATE  pffft_zconvolve_accumulate
-#define FUNC_ZCONVOLVE_NO_ACCU     pffft_zconvolve_no_accu
+/*
+   With PFFFT_KERNEL_SUFFIX defined this file builds one kernel for the
+   runtime dispatch in pffft_dispatch.c: every symbol gets the suffix,
+   and the setup is the kernel's own struct which the dispatching
+   PFFFT_Setup wraps. See pffft_kernels.h.
+*/
+#ifdef PFFFT_KERNEL_SUFFIX
+#  include "pffft_kernels.h"
+#  define SETUP_STRUCT             PFFFT_Kernel_Setup
+#else
+#  define PFFFT_KERNEL(name)       name
+#  define SETUP_STRUCT             PFFFT_Setup
+#endif
+#define FUNC_NEW_SETUP             PFFFT_KERNEL(pffft_new_setup)
+#define FUNC_DESTROY               PFFFT_KERNEL(pffft_destroy_setup)
+#define FUNC_TRANSFORM_UNORDRD     PFFFT_KERNEL(pffft_transform)
+#define FUNC_TRANSFORM_ORDERED     PFFFT_KERNEL(pffft_transform_ordered)
+#define FUNC_ZREORDER              PFFFT_KERNEL(pffft_zreorder)
+#define FUNC_ZCONVOLVE_ACCUMULATE  PFFFT_KERNEL(pffft_zconvolve_accumulate)
+#define FUNC_ZCONVOLVE_NO_ACCU     PFFFT_KERNEL(pffft_zconvolve_no_accu)
 
 #define FUNC_ALIGNED_MALLOC        pffft_aligned_malloc
 #define FUNC_ALIGNED_FREE          pffft_aligned_free
-#define FUNC_SIMD_SIZE             pffft_simd_size
-#define FUNC_MIN_FFT_SIZE          pffft_min_fft_size
-#define FUNC_IS_VALID_SIZE         pffft_is_valid_size
-#define FUNC_NEAREST_SIZE          pffft_nearest_transform_size
-#define FUNC_SIMD_ARCH             pffft_simd_arch
-#define FUNC_VALIDATE_SIMD_A       validate_pffft_simd
-#define FUNC_VALIDATE_SIMD_EX      validate_pffft_simd_ex
-
-#define FUNC_CPLX_FINALIZE         pffft_cplx_finalize
-#define FUNC_CPLX_PREPROCESS       pffft_cplx_preprocess
-#define FUNC_REAL_PREPROCESS_4X4   pffft_real_preprocess_4x4
-#define FUNC_REAL_PREPROCESS       pffft_real_preprocess
-#define FUNC_REAL_FINALIZE_4X4     pffft_real_finalize_4x4
-#define FUNC_REAL_FINALIZE         pffft_real_finalize
-#define FUNC_TRANSFORM_INTERNAL    pffft_transform_internal
+#define FUNC_SIMD_SIZE             PFFFT_KERNEL(pffft_simd_size)
+#define FUNC_MIN_FFT_SIZE          PFFFT_KERNEL(pffft_min_fft_size)
+#define FUNC_IS_VALID_SIZE         PFFFT_KERNEL(pffft_is_valid_size)
+#define FUNC_NEAREST_SIZE          PFFFT_KERNEL(pffft_nearest_transform_size)
+#define FUNC_SIMD_ARCH             PFFFT_KERNEL(pffft_simd_arch)
+#define FUNC_VALIDATE_SIMD_A       PFFFT_KERNEL(validate_pffft_simd)
+#define FUNC_VALIDATE_SIMD_EX      PFFFT_KERNEL(validate_pffft_simd_ex)
+
+#define FUNC_CPLX_FINALIZE         PFFFT_KERNEL(pffft_cplx_finalize)
+#define FUNC_CPLX_PREPROCESS       PFFFT_KERNEL(pffft_cplx_preprocess)
+#define FUNC_REAL_PREPROCESS_4X4   PFFFT_KERNEL(pffft_real_preprocess_4x4)
+#define FUNC_REAL_PREPROCESS       PFFFT_KERNEL(pffft_real_preprocess)
+#define FUNC_REAL_FINALIZE_4X4     PFFFT_KERNEL(pffft_real_finalize_4x4)
+#define FUNC_REAL_FINALIZE         PFFFT_KERNEL(pffft_real_finalize)
+#define FUNC_TRANSFORM_INTERNAL    PFFFT_KERNEL(pffft_transform_internal)
 
 #define FUNC_COS  cosf
 #define FUNC_SIN  sinf
@@ -131,4 +145,10 @@
 
 #include "pffft_priv_impl.h"
 
+#ifndef PFFFT_KERNEL_SUFFIX
+/* only one kernel without the runtime dispatch */
+int pffft_select_simd_arch(const char *arch) { return !arch || strcmp(arch, VARCH) == 0; }
+const char *pffft_setup_simd_arch(const PFFFT_Setup *setup) { (void)setup; return VARCH; }
+#endif
+
 
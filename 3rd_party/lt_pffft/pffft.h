@@ -64,9 +64,14 @@
    144, 160, etc are all acceptable lengths). Performance is best for
    128<=N<=8192.
 
+   - the AVX backend uses 8 element vectors and the AVX-512 backend 16,
+   for them the lengths are multiples of 128 and 512 for real and 64
+   and 256 for complex transforms. The runtime dispatch falls back to a
+   narrower kernel for the others.
+
    - all (float*) pointers in the functions below are expected to
    have an "simd-compatible" alignment, that is 16 bytes on x86 and
-   powerpc CPUs.
+   powerpc CPUs, 32 bytes with AVX and 64 bytes with AVX-512.
   
    You can allocate such buffers with the functions
    pffft_aligned_malloc / pffft_aligned_free (or with stuff like
@@ -193,12 +198,28 @@ extern "C" {
   */
   void pffft_zconvolve_no_accu(PFFFT_Setup *setup, const float *dft_a, const float *dft_b, float *dft_ab, float scaling);
 
-  /* return 4 or 1 wether support SSE/NEON/Altivec instructions was enabled when building pffft.c */
+  /* return the number of floats per vector, 16 with AVX-512, 8 with AVX, 4 with SSE/NEON/Altivec and 1 without SIMD,
+     with the runtime dispatch of the kernel pffft_new_setup currently picks */
   int pffft_simd_size();
 
-  /* return string identifier of used architecture (SSE/NEON/Altivec/..) */
+  /* return string identifier of used architecture (SSE/NEON/Altivec/..),
+     with the runtime dispatch the one pffft_new_setup currently picks */
   const char * pffft_simd_arch();
 
+  /* return string identifier of the architecture that the setup uses,
+     with the runtime dispatch the kernel it was created with */
+  const char * pffft_setup_simd_arch(const PFFFT_Setup *setup);
+
+  /*
+    x86-64 builds with the runtime dispatch contain SSE, AVX2 and AVX-512
+    kernels, and pffft_new_setup picks the widest one the CPU supports.
+    This forces the kernel for later setups by its pffft_simd_arch()
+    name, NULL goes back to the automatic choice. Returns 0 if that
+    kernel is not built or not supported by the CPU. Meant for testing,
+    it may be called from any thread. Existing setups keep their kernel.
+  */
+  int pffft_select_simd_arch(const char *arch);
+
 
   /* following functions are identical to the pffftd_ functions */
 
@@ -227,8 +248,8 @@ extern "C" {
 
   /*
     the float buffers must have the correct alignment (16-byte boundary
-    on intel and powerpc). This function may be used to obtain such
-    correctly aligned buffers.  
+    on intel and powerpc, 64 with AVX-512). This function may be used to
+    obtain such correctly aligned buffers, they are aligned to 64 bytes.  
   */
   void *pffft_aligned_malloc(size_t nb_bytes);
   void pffft_aligned_free(void *);
@@ -34,6 +34,11 @@
 #include <vector>
 #include <limits>
 #include <cassert>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
 
 namespace pffft {
 namespace detail {
@@ -60,6 +65,7 @@ template<> struct Types<float>  {
   typedef ::std::complex<Scalar> Complex;
   static int simd_size() { return detail::pffft_simd_size(); }
   static const char * simd_arch() { return detail::pffft_simd_arch(); }
+  static bool select_simd_arch(const char * arch) { return detail::pffft_select_simd_arch(arch) != 0; }
   static int minFFtsize() { return pffft_min_fft_size(detail::PFFFT_REAL); }
   static bool isValidSize(int N) { return pffft_is_valid_size(N, detail::PFFFT_REAL); }
   static int nearestTransformSize(int N, bool higher) { return pffft_nearest_transform_size(N, detail::PFFFT_REAL, higher ? 1 : 0); }
@@ -69,6 +75,7 @@ template<> struct Types< ::std::complex<float> >  {
   typedef ::std::complex<float>  Complex;
   static int simd_size() { return detail::pffft_simd_size(); }
   static const char * simd_arch() { return detail::pffft_simd_arch(); }
+  static bool select_simd_arch(const char * arch) { return detail::pffft_select_simd_arch(arch) != 0; }
   static int minFFtsize() { return pffft_min_fft_size(detail::PFFFT_COMPLEX); }
   static bool isValidSize(int N) { return pffft_is_valid_size(N, detail::PFFFT_COMPLEX); }
   static int nearestTransformSize(int N, bool higher) { return pffft_nearest_transform_size(N, detail::PFFFT_COMPLEX, higher ? 1 : 0); }
@@ -80,6 +87,7 @@ template<> struct Types<double> {
   typedef ::std::complex<Scalar> Complex;
   static int simd_size() { return detail::pffftd_simd_size(); }
   static const char * simd_arch() { return detail::pffftd_simd_arch(); }
+  static bool select_simd_arch(const char * arch) { return detail::pffftd_select_simd_arch(arch) != 0; }
   static int minFFtsize() { return pffftd_min_fft_size(detail::PFFFT_REAL); }
   static bool isValidSize(int N) { return pffftd_is_valid_size(N, detail::PFFFT_REAL); }
   static int nearestTransformSize(int N, bool higher) { return pffftd_nearest_transform_size(N, detail::PFFFT_REAL, higher ? 1 : 0); }
@@ -89,6 +97,7 @@ template<> struct Types< ::std::complex<double> > {
   typedef ::std::complex<double> Complex;
   static int simd_size() { return detail::pffftd_simd_size(); }
   static const char * simd_arch() { return detail::pffftd_simd_arch(); }
+  static bool select_simd_arch(const char * arch) { return detail::pffftd_select_simd_arch(arch) != 0; }
   static int minFFtsize() { return pffftd_min_fft_size(detail::PFFFT_COMPLEX); }
   static bool isValidSize(int N) { return pffftd_is_valid_size(N, detail::PFFFT_COMPLEX); }
   static int nearestTransformSize(int N, bool higher) { return pffftd_nearest_transform_size(N, detail::PFFFT_COMPLEX, higher ? 1 : 0); }
@@ -145,6 +154,14 @@ public:
   static int simd_size() { return Types<T>::simd_size(); }
   static const char * simd_arch() { return Types<T>::simd_arch(); }
 
+  // force the SIMD kernel of later setups, see pffft_select_simd_arch(); nullptr for the automatic choice
+  static bool select_simd_arch(const char * arch) { return Types<T>::select_simd_arch(arch); }
+
+  // create the setup for 'length' in the process wide setup cache and keep it until releasePrewarmedSetups(),
+  // so constructing Fft objects of that length and type later neither computes twiddles nor allocates.
+  // returns false for invalid lengths
+  static bool prewarm(int length) { return detail::Setup<T>::prewarm(length); }
+
   // simple helper to get minimum possible fft length
   static int minFFtsize() { return Types<T>::minFFtsize(); }
 
@@ -158,14 +175,11 @@ public:
   /*
    * Contructor, with transformation length, preparing transforms.
    *
-   * For length <= stackThresholdLen, the stack is used for the internal
-   * work memory. for bigger length', the heap is used.
-   *
-   * Using the stack is probably the best strategy for small
-   * FFTs, say for N <= 4096). Threads usually have a small stack, that
-   * there's no sufficient amount of memory, usually leading to a crash!
+   * The internal work memory is neither on the stack nor per instance:
+   * all Fft objects used on a thread share that thread's scratch arena,
+   * see reserveScratch().
    */
-  Fft( int length, int stackThresholdLen = 4096 );
+  Fft( int length );
 
 
   /*
@@ -175,8 +189,6 @@ public:
   bool isValid() const;
 
 
-  ~Fft();
-
   /*
    * prepare for transformation length 'newLength'.
    * length is identical to forward()'s input vector's size,
@@ -191,6 +203,28 @@ public:
    */
   int getLength() const { return length; }
 
+  /*
+   * Fft objects of the same length and type share their read-only setup
+   * (twiddle factors and factorization), the work memory is per thread.
+   */
+  bool sharesSetupWith(const Fft & other) const { return setup.sharesWith(other.setup); }
+
+  /*
+   * the SIMD kernel of this instance's setup, with the runtime dispatch
+   * the one it was created with, see simd_arch(). nullptr if !isValid()
+   */
+  const char * setupSimdArch() const { return setup.simdArch(); }
+
+  /*
+   * Grow the calling thread's scratch arena to fit this transform.
+   * The arena only grows and is freed when the thread exits.
+   * prepareLength() reserves on the thread calling it, every other thread
+   * that runs transforms must call this before its first one. A transform
+   * on a thread whose arena is too small asserts, without assertions it
+   * grows the arena, allocating on that thread.
+   */
+  void reserveScratch() const;
+
   /*
    * retrieve size of complex spectrum vector,
    * the output of forward()
@@ -387,10 +421,10 @@ public:
                              const Scalar scaling);
 
 private:
+  Scalar* scratch() const;
+
   detail::Setup<T> setup;
-  Scalar* work;
   int length;
-  int stackThresholdLen;
 };
 
 
@@ -421,6 +455,167 @@ inline bool isPowerOfTwo(int N) {
 
 namespace detail {
 
+/*
+ * Work memory of the transforms, one arena per thread shared by all
+ * Fft objects used on it. Memory use scales with the number of threads,
+ * not with the number of Fft objects.
+ */
+class ScratchArena
+{
+public:
+  static void* reserve(::std::size_t bytes)
+  {
+    ScratchArena & arena = local();
+    if (bytes > arena.size) {
+      pffft_aligned_free(arena.data);
+      arena.data = pffft_aligned_malloc(bytes);
+      arena.size = arena.data ? bytes : 0;
+    }
+    return arena.data;
+  }
+
+  // the transforms' access, reserve() must have been called on this thread
+  static void* get(::std::size_t bytes)
+  {
+    ScratchArena & arena = local();
+    assert(bytes <= arena.size && "pffft: reserveScratch() was not called on this thread");
+    return bytes <= arena.size ? arena.data : reserve(bytes);
+  }
+
+  static ::std::size_t capacity() { return local().size; }
+
+private:
+  ScratchArena() : data(NULL), size(0) {}
+  ~ScratchArena() { pffft_aligned_free(data); }
+
+  static ScratchArena & local()
+  {
+    static thread_local ScratchArena arena;
+    return arena;
+  }
+
+  void* data;
+  ::std::size_t size;
+};
+
+template<typename SetupType>
+struct SetupFunctions;
+
+#if defined(PFFFT_ENABLE_FLOAT) || ( !defined(PFFFT_ENABLE_FLOAT) && !defined(PFFFT_ENABLE_DOUBLE) )
+template<>
+struct SetupFunctions<PFFFT_Setup>
+{
+  static PFFFT_Setup* create(int length, pffft_transform_t transform) { return pffft_new_setup(length, transform); }
+  static void destroy(PFFFT_Setup* setup) { pffft_destroy_setup(setup); }
+  static const char* simdArch() { return pffft_simd_arch(); }
+};
+#endif
+
+#if defined(PFFFT_ENABLE_DOUBLE)
+template<>
+struct SetupFunctions<PFFFTD_Setup>
+{
+  static PFFFTD_Setup* create(int length, pffft_transform_t transform) { return pffftd_new_setup(length, transform); }
+  static void destroy(PFFFTD_Setup* setup) { pffftd_destroy_setup(setup); }
+  static const char* simdArch() { return pffftd_simd_arch(); }
+};
+#endif
+
+/*
+ * Process wide cache of the setups of one precision, keyed by length,
+ * transform type and SIMD kernel. The transforms only read from a setup,
+ * so any number of Fft objects and threads can use the same one.
+ *
+ * The cache only holds weak references: a setup is destroyed together
+ * with the last Fft using it, unless prewarm() pinned it.
+ */
+template<typename SetupType>
+class SetupCache
+{
+public:
+  typedef ::std::shared_ptr<SetupType> Handle;
+
+  static Handle acquire(int length, pffft_transform_t transform)
+  {
+    SetupCache & cache = instance();
+    const Key key = makeKey(length, transform);
+    ::std::lock_guard< ::std::mutex > lock(cache.mutex);
+
+    Handle setup = cache.entries[key].lock();
+    if (!setup) {
+      SetupType* created = SetupFunctions<SetupType>::create(length, transform);
+      if (!created) {
+        cache.entries.erase(key);
+        return Handle();
+      }
+      setup = Handle(created, &SetupFunctions<SetupType>::destroy);
+      cache.removeExpired();
+      cache.entries[key] = setup;
+    }
+    return setup;
+  }
+
+  static bool prewarm(int length, pffft_transform_t transform)
+  {
+    Handle setup = acquire(length, transform);
+    if (!setup)
+      return false;
+
+    SetupCache & cache = instance();
+    ::std::lock_guard< ::std::mutex > lock(cache.mutex);
+    cache.pinned[makeKey(length, transform)] = setup;
+    return true;
+  }
+
+  static void releasePrewarmed()
+  {
+    // destroy the setups outside of the lock
+    ::std::map<Key, Handle> released;
+    SetupCache & cache = instance();
+    ::std::lock_guard< ::std::mutex > lock(cache.mutex);
+    released.swap(cache.pinned);
+  }
+
+  // number of setups alive, pinned or used by an Fft
+  static int size()
+  {
+    SetupCache & cache = instance();
+    ::std::lock_guard< ::std::mutex > lock(cache.mutex);
+    cache.removeExpired();
+    return static_cast<int>(cache.entries.size());
+  }
+
+private:
+  typedef ::std::pair< ::std::pair<int, int>, ::std::string > Key;
+  typedef ::std::map< Key, ::std::weak_ptr<SetupType> > Entries;
+
+  static Key makeKey(int length, pffft_transform_t transform)
+  {
+    // a setup keeps the kernel it was created with, see pffft_select_simd_arch()
+    return Key(::std::make_pair(length, static_cast<int>(transform)), SetupFunctions<SetupType>::simdArch());
+  }
+
+  static SetupCache & instance()
+  {
+    static SetupCache cache;
+    return cache;
+  }
+
+  void removeExpired()
+  {
+    for (typename Entries::iterator it = entries.begin(); it != entries.end();) {
+      if (it->second.expired())
+        entries.erase(it++);
+      else
+        ++it;
+    }
+  }
+
+  ::std::mutex mutex;
+  Entries entries;
+  ::std::map<Key, Handle> pinned;
+};
+
 template<typename T>
 class Setup
 {};
@@ -430,34 +625,40 @@ class Setup
 template<>
 class Setup<float>
 {
-  PFFFT_Setup* self;
+  typedef SetupCache<PFFFT_Setup> Cache;
+
+  Cache::Handle self;
 
 public:
   typedef float value_type;
   typedef Types< value_type >::Scalar Scalar;
 
   Setup()
-    : self(NULL)
+    : self()
   {}
 
-  ~Setup() { pffft_destroy_setup(self); }
-
   void prepareLength(int length)
   {
-    if (self) {
-      pffft_destroy_setup(self);
+    self.reset();
+    if (length > 0) {
+      self = Cache::acquire(length, PFFFT_REAL);
     }
-    self = pffft_new_setup(length, PFFFT_REAL);
   }
 
-  bool isValid() const { return (self); }
+  static bool prewarm(int length) { return length > 0 && Cache::prewarm(length, PFFFT_REAL); }
+
+  bool isValid() const { return static_cast<bool>(self); }
+
+  bool sharesWith(const Setup & other) const { return self && self == other.self; }
+
+  const char* simdArch() const { return self ? pffft_setup_simd_arch(self.get()) : 0; }
 
   void transform_ordered(const Scalar* input,
                          Scalar* output,
                          Scalar* work,
                          pffft_direction_t direction)
   {
-    pffft_transform_ordered(self, input, output, work, direction);
+    pffft_transform_ordered(self.get(), input, output, work, direction);
   }
 
   void transform(const Scalar* input,
@@ -465,12 +666,12 @@ public:
                  Scalar* work,
                  pffft_direction_t direction)
   {
-    pffft_transform(self, input, output, work, direction);
+    pffft_transform(self.get(), input, output, work, direction);
   }
 
   void reorder(const Scalar* input, Scalar* output, pffft_direction_t direction)
   {
-    pffft_zreorder(self, input, output, direction);
+    pffft_zreorder(self.get(), input, output, direction);
   }
 
   void convolveAccumulate(const Scalar* dft_a,
@@ -478,7 +679,7 @@ public:
                           Scalar* dft_ab,
                           const Scalar scaling)
   {
-    pffft_zconvolve_accumulate(self, dft_a, dft_b, dft_ab, scaling);
+    pffft_zconvolve_accumulate(self.get(), dft_a, dft_b, dft_ab, scaling);
   }
 
   void convolve(const Scalar* dft_a,
@@ -486,7 +687,7 @@ public:
                 Scalar* dft_ab,
                 const Scalar scaling)
   {
-    pffft_zconvolve_no_accu(self, dft_a, dft_b, dft_ab, scaling);
+    pffft_zconvolve_no_accu(self.get(), dft_a, dft_b, dft_ab, scaling);
   }
 };
 
@@ -494,34 +695,40 @@ public:
 template<>
 class Setup< ::std::complex<float> >
 {
-  PFFFT_Setup* self;
+  typedef SetupCache<PFFFT_Setup> Cache;
+
+  Cache::Handle self;
 
 public:
   typedef ::std::complex<float> value_type;
   typedef Types< value_type >::Scalar Scalar;
 
   Setup()
-    : self(NULL)
+    : self()
   {}
 
-  ~Setup() { pffft_destroy_setup(self); }
-
   void prepareLength(int length)
   {
-    if (self) {
-      pffft_destroy_setup(self);
+    self.reset();
+    if (length > 0) {
+      self = Cache::acquire(length, PFFFT_COMPLEX);
     }
-    self = pffft_new_setup(length, PFFFT_COMPLEX);
   }
 
-  bool isValid() const { return (self); }
+  static bool prewarm(int length) { return length > 0 && Cache::prewarm(length, PFFFT_COMPLEX); }
+
+  bool isValid() const { return static_cast<bool>(self); }
+
+  bool sharesWith(const Setup & other) const { return self && self == other.self; }
+
+  const char* simdArch() const { return self ? pffft_setup_simd_arch(self.get()) : 0; }
 
   void transform_ordered(const Scalar* input,
                          Scalar* output,
                          Scalar* work,
                          pffft_direction_t direction)
   {
-    pffft_transform_ordered(self, input, output, work, direction);
+    pffft_transform_ordered(self.get(), input, output, work, direction);
   }
 
   void transform(const Scalar* input,
@@ -529,12 +736,12 @@ public:
                  Scalar* work,
                  pffft_direction_t direction)
   {
-    pffft_transform(self, input, output, work, direction);
+    pffft_transform(self.get(), input, output, work, direction);
   }
 
   void reorder(const Scalar* input, Scalar* output, pffft_direction_t direction)
   {
-    pffft_zreorder(self, input, output, direction);
+    pffft_zreorder(self.get(), input, output, direction);
   }
 
   void convolve(const Scalar* dft_a,
@@ -542,7 +749,7 @@ public:
                 Scalar* dft_ab,
                 const Scalar scaling)
   {
-    pffft_zconvolve_no_accu(self, dft_a, dft_b, dft_ab, scaling);
+    pffft_zconvolve_no_accu(self.get(), dft_a, dft_b, dft_ab, scaling);
   }
 };
 
@@ -554,37 +761,40 @@ public:
 template<>
 class Setup<double>
 {
-  PFFFTD_Setup* self;
+  typedef SetupCache<PFFFTD_Setup> Cache;
+
+  Cache::Handle self;
 
 public:
   typedef double value_type;
   typedef Types< value_type >::Scalar Scalar;
 
   Setup()
-    : self(NULL)
+    : self()
   {}
 
-  ~Setup() { pffftd_destroy_setup(self); }
-
   void prepareLength(int length)
   {
-    if (self) {
-      pffftd_destroy_setup(self);
-      self = NULL;
-    }
+    self.reset();
     if (length > 0) {
-      self = pffftd_new_setup(length, PFFFT_REAL);
+      self = Cache::acquire(length, PFFFT_REAL);
     }
   }
 
-  bool isValid() const { return (self); }
+  static bool prewarm(int length) { return length > 0 && Cache::prewarm(length, PFFFT_REAL); }
+
+  bool isValid() const { return static_cast<bool>(self); }
+
+  bool sharesWith(const Setup & other) const { return self && self == other.self; }
+
+  const char* simdArch() const { return self ? pffftd_setup_simd_arch(self.get()) : 0; }
 
   void transform_ordered(const Scalar* input,
                          Scalar* output,
                          Scalar* work,
                          pffft_direction_t direction)
   {
-    pffftd_transform_ordered(self, input, output, work, direction);
+    pffftd_transform_ordered(self.get(), input, output, work, direction);
   }
 
   void transform(const Scalar* input,
@@ -592,12 +802,12 @@ public:
                  Scalar* work,
                  pffft_direction_t direction)
   {
-    pffftd_transform(self, input, output, work, direction);
+    pffftd_transform(self.get(), input, output, work, direction);
   }
 
   void reorder(const Scalar* input, Scalar* output, pffft_direction_t direction)
   {
-    pffftd_zreorder(self, input, output, direction);
+    pffftd_zreorder(self.get(), input, output, direction);
   }
 
   void convolveAccumulate(const Scalar* dft_a,
@@ -605,7 +815,7 @@ public:
                           Scalar* dft_ab,
                           const Scalar scaling)
   {
-    pffftd_zconvolve_accumulate(self, dft_a, dft_b, dft_ab, scaling);
+    pffftd_zconvolve_accumulate(self.get(), dft_a, dft_b, dft_ab, scaling);
   }
 
   void convolve(const Scalar* dft_a,
@@ -613,41 +823,47 @@ public:
                 Scalar* dft_ab,
                 const Scalar scaling)
   {
-    pffftd_zconvolve_no_accu(self, dft_a, dft_b, dft_ab, scaling);
+    pffftd_zconvolve_no_accu(self.get(), dft_a, dft_b, dft_ab, scaling);
   }
 };
 
 template<>
 class Setup< ::std::complex<double> >
 {
-  PFFFTD_Setup* self;
+  typedef SetupCache<PFFFTD_Setup> Cache;
+
+  Cache::Handle self;
 
 public:
   typedef ::std::complex<double> value_type;
   typedef Types< value_type >::Scalar Scalar;
 
   Setup()
-    : self(NULL)
+    : self()
   {}
 
-  ~Setup() { pffftd_destroy_setup(self); }
-
   void prepareLength(int length)
   {
-    if (self) {
-      pffftd_destroy_setup(self);
+    self.reset();
+    if (length > 0) {
+      self = Cache::acquire(length, PFFFT_COMPLEX);
     }
-    self = pffftd_new_setup(length, PFFFT_COMPLEX);
   }
 
-  bool isValid() const { return (self); }
+  static bool prewarm(int length) { return length > 0 && Cache::prewarm(length, PFFFT_COMPLEX); }
+
+  bool isValid() const { return static_cast<bool>(self); }
+
+  bool sharesWith(const Setup & other) const { return self && self == other.self; }
+
+  const char* simdArch() const { return self ? pffftd_setup_simd_arch(self.get()) : 0; }
 
   void transform_ordered(const Scalar* input,
                          Scalar* output,
                          Scalar* work,
                          pffft_direction_t direction)
   {
-    pffftd_transform_ordered(self, input, output, work, direction);
+    pffftd_transform_ordered(self.get(), input, output, work, direction);
   }
 
   void transform(const Scalar* input,
@@ -655,12 +871,12 @@ public:
                  Scalar* work,
                  pffft_direction_t direction)
   {
-    pffftd_transform(self, input, output, work, direction);
+    pffftd_transform(self.get(), input, output, work, direction);
   }
 
   void reorder(const Scalar* input, Scalar* output, pffft_direction_t direction)
   {
-    pffftd_zreorder(self, input, output, direction);
+    pffftd_zreorder(self.get(), input, output, direction);
   }
 
   void convolveAccumulate(const Scalar* dft_a,
@@ -668,7 +884,7 @@ public:
                           Scalar* dft_ab,
                           const Scalar scaling)
   {
-    pffftd_zconvolve_accumulate(self, dft_a, dft_b, dft_ab, scaling);
+    pffftd_zconvolve_accumulate(self.get(), dft_a, dft_b, dft_ab, scaling);
   }
 
   void convolve(const Scalar* dft_a,
@@ -676,7 +892,7 @@ public:
                 Scalar* dft_ab,
                 const Scalar scaling)
   {
-    pffftd_zconvolve_no_accu(self, dft_a, dft_b, dft_ab, scaling);
+    pffftd_zconvolve_no_accu(self.get(), dft_a, dft_b, dft_ab, scaling);
   }
 };
 
@@ -685,11 +901,40 @@ public:
 } // end of anonymous namespace for Setup<>
 
 
+// unpin all setups created by Fft<T>::prewarm(), they stay alive as long as Fft objects use them
+inline void releasePrewarmedSetups()
+{
+#if defined(PFFFT_ENABLE_FLOAT) || ( !defined(PFFFT_ENABLE_FLOAT) && !defined(PFFFT_ENABLE_DOUBLE) )
+  detail::SetupCache<detail::PFFFT_Setup>::releasePrewarmed();
+#endif
+#if defined(PFFFT_ENABLE_DOUBLE)
+  detail::SetupCache<detail::PFFFTD_Setup>::releasePrewarmed();
+#endif
+}
+
+// number of distinct setups currently alive in the process, over all lengths, types and precisions
+inline int cachedSetupCount()
+{
+  int count = 0;
+#if defined(PFFFT_ENABLE_FLOAT) || ( !defined(PFFFT_ENABLE_FLOAT) && !defined(PFFFT_ENABLE_DOUBLE) )
+  count += detail::SetupCache<detail::PFFFT_Setup>::size();
+#endif
+#if defined(PFFFT_ENABLE_DOUBLE)
+  count += detail::SetupCache<detail::PFFFTD_Setup>::size();
+#endif
+  return count;
+}
+
+// bytes of work memory held by the calling thread's scratch arena
+inline ::std::size_t scratchCapacity()
+{
+  return detail::ScratchArena::capacity();
+}
+
+
 template<typename T>
-inline Fft<T>::Fft(int length, int stackThresholdLen)
-  : work(NULL)
-  , length(0)
-  , stackThresholdLen(stackThresholdLen)
+inline Fft<T>::Fft(int length)
+  : length(0)
 {
 #if (__cplusplus >= 201103L || (defined(_MSC_VER) && _MSC_VER >= 1900))
   static_assert( sizeof(Complex) == 2 * sizeof(Scalar), "pffft requires sizeof(::std::complex<>) == 2 * sizeof(Scalar)" );
@@ -699,12 +944,6 @@ inline Fft<T>::Fft(int length, int stackThresholdLen)
   prepareLength(length);
 }
 
-template<typename T>
-inline Fft<T>::~Fft()
-{
-  alignedFree(work);
-}
-
 template<typename T>
 inline bool
 Fft<T>::isValid() const
@@ -719,11 +958,8 @@ Fft<T>::prepareLength(int newLength)
   if(newLength < minFFtsize())
     return false;
 
-  const bool wasOnHeap = ( work != NULL );
-
-  const bool useHeap = newLength > stackThresholdLen;
-
-  if (useHeap == wasOnHeap && newLength == length) {
+  if (newLength == length) {
+    reserveScratch();
     return true;
   }
 
@@ -734,17 +970,23 @@ Fft<T>::prepareLength(int newLength)
     return false;
 
   length = newLength;
+  reserveScratch();
 
-  if (work) {
-    alignedFree(work);
-    work = NULL;
-  }
+  return true;
+}
 
-  if (useHeap) {
-    work = reinterpret_cast<Scalar*>( alignedAllocType(length) );
-  }
+template<typename T>
+inline void
+Fft<T>::reserveScratch() const
+{
+  detail::ScratchArena::reserve(getInternalLayoutSize() * sizeof(Scalar));
+}
 
-  return true;
+template<typename T>
+inline typename Fft<T>::Scalar*
+Fft<T>::scratch() const
+{
+  return static_cast<Scalar*>( detail::ScratchArena::get(getInternalLayoutSize() * sizeof(Scalar)) );
 }
 
 
@@ -850,7 +1092,7 @@ Fft<T>::forward(const T* input, Complex * spectrum)
   assert(isValid());
   setup.transform_ordered(reinterpret_cast<const Scalar*>(input),
                           reinterpret_cast<Scalar*>(spectrum),
-                          work,
+                          scratch(),
                           detail::PFFFT_FORWARD);
   return spectrum;
 }
@@ -862,7 +1104,7 @@ Fft<T>::inverse(Complex const* spectrum, T* output)
   assert(isValid());
   setup.transform_ordered(reinterpret_cast<const Scalar*>(spectrum),
                           reinterpret_cast<Scalar*>(output),
-                          work,
+                          scratch(),
                           detail::PFFFT_BACKWARD);
   return output;
 }
@@ -874,7 +1116,7 @@ Fft<T>::forwardToInternalLayout(const T* input, Scalar* spectrum_internal_layout
   assert(isValid());
   setup.transform(reinterpret_cast<const Scalar*>(input),
                   spectrum_internal_layout,
-                  work,
+                  scratch(),
                   detail::PFFFT_FORWARD);
   return spectrum_internal_layout;
 }
@@ -886,7 +1128,7 @@ Fft<T>::inverseFromInternalLayout(const Scalar* spectrum_internal_layout, T* out
   assert(isValid());
   setup.transform(spectrum_internal_layout,
                   reinterpret_cast<Scalar*>(output),
-                  work,
+                  scratch(),
                   detail::PFFFT_BACKWARD);
   return output;
 }
@@ -0,0 +1,177 @@
+/*
+   Runtime SIMD dispatch for x86-64.
+
+   Instead of fixing the instruction set at compile time, the kernels in
+   kernels/ are built for SSE, AVX2 and AVX-512 side by side, see
+   pffft_kernels.h. pffft_new_setup and pffftd_new_setup pick the widest
+   kernel that the CPU and the OS support, and the setup keeps using it.
+   pffft_select_simd_arch and pffftd_select_simd_arch override the choice
+   for testing.
+
+   Any thread may create setups while another one selects a kernel, so
+   the selection and the detected CPU support are read and written with
+   atomic accesses.
+*/
+
+#include "pffft_kernels.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_MSC_VER)
+#  include <intrin.h>
+#else
+#  include <cpuid.h>
+#endif
+
+#if defined(_MSC_VER)
+#  define PFFFT_LOAD_PTR(p)      _InterlockedCompareExchangePointer((void * volatile *)(p), 0, 0)
+#  define PFFFT_STORE_PTR(p, v)  _InterlockedExchangePointer((void * volatile *)(p), (void *)(v))
+#  define PFFFT_LOAD_INT(p)      _InterlockedOr((volatile long *)(p), 0)
+#  define PFFFT_STORE_INT(p, v)  _InterlockedExchange((volatile long *)(p), (long)(v))
+#else
+#  define PFFFT_LOAD_PTR(p)      __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#  define PFFFT_STORE_PTR(p, v)  __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#  define PFFFT_LOAD_INT(p)      __atomic_load_n((p), __ATOMIC_RELAXED)
+#  define PFFFT_STORE_INT(p, v)  __atomic_store_n((p), (v), __ATOMIC_RELAXED)
+#endif
+
+enum { PFFFT_CPU_SSE, PFFFT_CPU_AVX2, PFFFT_CPU_AVX512 };
+
+static void pffft_cpuid(unsigned leaf, unsigned regs[4]) {
+#if defined(_MSC_VER)
+  int r[4];
+  __cpuidex(r, (int)leaf, 0);
+  regs[0] = (unsigned)r[0]; regs[1] = (unsigned)r[1]; regs[2] = (unsigned)r[2]; regs[3] = (unsigned)r[3];
+#else
+  __cpuid_count(leaf, 0, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+/* the register state the OS saves on context switches */
+static unsigned long long pffft_xcr0() {
+#if defined(_MSC_VER)
+  return _xgetbv(0);
+#else
+  unsigned eax, edx;
+  __asm__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+  return ((unsigned long long)edx << 32) | eax;
+#endif
+}
+
+/* the widest kernel that the CPU and the OS support, one of PFFFT_CPU_* */
+static int pffft_detect_cpu_support() {
+  const unsigned osxsave_avx_fma = (1u << 27) | (1u << 28) | (1u << 12);
+  const unsigned avx512f_vl = (1u << 16) | (1u << 31);
+  unsigned regs[4];
+  unsigned long long xcr0;
+
+  pffft_cpuid(0, regs);
+  if (regs[0] < 7)
+    return PFFFT_CPU_SSE;
+
+  pffft_cpuid(1, regs);
+  if ((regs[2] & osxsave_avx_fma) != osxsave_avx_fma)
+    return PFFFT_CPU_SSE;
+
+  /* XMM and YMM state */
+  xcr0 = pffft_xcr0();
+  if ((xcr0 & 0x6) != 0x6)
+    return PFFFT_CPU_SSE;
+
+  pffft_cpuid(7, regs);
+  if (!(regs[1] & (1u << 5)))
+    return PFFFT_CPU_SSE;
+
+  /* also opmask and ZMM state */
+  if ((regs[1] & avx512f_vl) == avx512f_vl && (xcr0 & 0xE0) == 0xE0)
+    return PFFFT_CPU_AVX512;
+  return PFFFT_CPU_AVX2;
+}
+
+/* pffft_detect_cpu_support() of the first call. Racing first calls
+   detect the same support, so either store is right. */
+static long pffft_cpu_support_cache = -1;
+
+static int pffft_cpu_support() {
+  long support = PFFFT_LOAD_INT(&pffft_cpu_support_cache);
+  if (support < 0) {
+    support = pffft_detect_cpu_support();
+    PFFFT_STORE_INT(&pffft_cpu_support_cache, support);
+  }
+  return (int)support;
+}
+
+#define SETUP_STRUCT               PFFFT_Setup
+#define KERNEL_SETUP_STRUCT        PFFFT_Kernel_Setup
+#define KERNEL_STRUCT              PFFFT_Kernel
+#define VAR_KERNELS                pffft_kernels
+#define VAR_SELECTED_KERNEL        pffft_selected_kernel
+#define FUNC_CURRENT_KERNEL        pffft_current_kernel
+#define FUNC_NEW_SETUP             pffft_new_setup
+#define FUNC_DESTROY               pffft_destroy_setup
+#define FUNC_TRANSFORM_UNORDRD     pffft_transform
+#define FUNC_TRANSFORM_ORDERED     pffft_transform_ordered
+#define FUNC_ZREORDER              pffft_zreorder
+#define FUNC_ZCONVOLVE_ACCUMULATE  pffft_zconvolve_accumulate
+#define FUNC_ZCONVOLVE_NO_ACCU     pffft_zconvolve_no_accu
+#define FUNC_SIMD_SIZE             pffft_simd_size
+#define FUNC_MIN_FFT_SIZE          pffft_min_fft_size
+#define FUNC_IS_VALID_SIZE         pffft_is_valid_size
+#define FUNC_NEAREST_SIZE          pffft_nearest_transform_size
+#define FUNC_SIMD_ARCH             pffft_simd_arch
+#define FUNC_SETUP_SIMD_ARCH       pffft_setup_simd_arch
+#define FUNC_SELECT_SIMD_ARCH      pffft_select_simd_arch
+#define FUNC_VALIDATE_SIMD_A       validate_pffft_simd
+#define FUNC_VALIDATE_SIMD_EX      validate_pffft_simd_ex
+
+#include "pffft_dispatch_impl.h"
+
+#undef SETUP_STRUCT
+#undef KERNEL_SETUP_STRUCT
+#undef KERNEL_STRUCT
+#undef VAR_KERNELS
+#undef VAR_SELECTED_KERNEL
+#undef FUNC_CURRENT_KERNEL
+#undef FUNC_NEW_SETUP
+#undef FUNC_DESTROY
+#undef FUNC_TRANSFORM_UNORDRD
+#undef FUNC_TRANSFORM_ORDERED
+#undef FUNC_ZREORDER
+#undef FUNC_ZCONVOLVE_ACCUMULATE
+#undef FUNC_ZCONVOLVE_NO_ACCU
+#undef FUNC_SIMD_SIZE
+#undef FUNC_MIN_FFT_SIZE
+#undef FUNC_IS_VALID_SIZE
+#undef FUNC_NEAREST_SIZE
+#undef FUNC_SIMD_ARCH
+#undef FUNC_SETUP_SIMD_ARCH
+#undef FUNC_SELECT_SIMD_ARCH
+#undef FUNC_VALIDATE_SIMD_A
+#undef FUNC_VALIDATE_SIMD_EX
+
+#define float double
+#define SETUP_STRUCT               PFFFTD_Setup
+#define KERNEL_SETUP_STRUCT        PFFFTD_Kernel_Setup
+#define KERNEL_STRUCT              PFFFTD_Kernel
+#define VAR_KERNELS                pffftd_kernels
+#define VAR_SELECTED_KERNEL        pffftd_selected_kernel
+#define FUNC_CURRENT_KERNEL        pffftd_current_kernel
+#define FUNC_NEW_SETUP             pffftd_new_setup
+#define FUNC_DESTROY               pffftd_destroy_setup
+#define FUNC_TRANSFORM_UNORDRD     pffftd_transform
+#define FUNC_TRANSFORM_ORDERED     pffftd_transform_ordered
+#define FUNC_ZREORDER              pffftd_zreorder
+#define FUNC_ZCONVOLVE_ACCUMULATE  pffftd_zconvolve_accumulate
+#define FUNC_ZCONVOLVE_NO_ACCU     pffftd_zconvolve_no_accu
+#define FUNC_SIMD_SIZE             pffftd_simd_size
+#define FUNC_MIN_FFT_SIZE          pffftd_min_fft_size
+#define FUNC_IS_VALID_SIZE         pffftd_is_valid_size
+#define FUNC_NEAREST_SIZE          pffftd_nearest_transform_size
+#define FUNC_SIMD_ARCH             pffftd_simd_arch
+#define FUNC_SETUP_SIMD_ARCH       pffftd_setup_simd_arch
+#define FUNC_SELECT_SIMD_ARCH      pffftd_select_simd_arch
+#define FUNC_VALIDATE_SIMD_A       validate_pffftd_simd
+#define FUNC_VALIDATE_SIMD_EX      validate_pffftd_simd_ex
+
+#include "pffft_dispatch_impl.h"
@@ -0,0 +1,135 @@
+/*
+   Public pffft_ / pffftd_ functions on top of the kernels, included
+   once per precision by pffft_dispatch.c, see pffft_kernels.h.
+*/
+
+typedef struct {
+  const char *(*simd_arch)();
+  int (*simd_size)();
+  KERNEL_SETUP_STRUCT *(*new_setup)(int N, pffft_transform_t transform);
+  void (*destroy_setup)(KERNEL_SETUP_STRUCT *setup);
+  void (*transform)(KERNEL_SETUP_STRUCT *setup, const float *input, float *output, float *work,
+                    pffft_direction_t direction);
+  void (*transform_ordered)(KERNEL_SETUP_STRUCT *setup, const float *input, float *output, float *work,
+                            pffft_direction_t direction);
+  void (*zreorder)(KERNEL_SETUP_STRUCT *setup, const float *input, float *output, pffft_direction_t direction);
+  void (*zconvolve_accumulate)(KERNEL_SETUP_STRUCT *setup, const float *dft_a, const float *dft_b, float *dft_ab,
+                               float scaling);
+  void (*zconvolve_no_accu)(KERNEL_SETUP_STRUCT *setup, const float *dft_a, const float *dft_b, float *dft_ab,
+                            float scaling);
+  void (*validate_simd)();
+  int (*validate_simd_ex)(FILE *DbgOut);
+} KERNEL_STRUCT;
+
+#define KERNEL_TABLE(suffix) {                          \
+    PFFFT_KERNEL_CAT(FUNC_SIMD_ARCH, suffix),            \
+    PFFFT_KERNEL_CAT(FUNC_SIMD_SIZE, suffix),            \
+    PFFFT_KERNEL_CAT(FUNC_NEW_SETUP, suffix),            \
+    PFFFT_KERNEL_CAT(FUNC_DESTROY, suffix),              \
+    PFFFT_KERNEL_CAT(FUNC_TRANSFORM_UNORDRD, suffix),    \
+    PFFFT_KERNEL_CAT(FUNC_TRANSFORM_ORDERED, suffix),    \
+    PFFFT_KERNEL_CAT(FUNC_ZREORDER, suffix),             \
+    PFFFT_KERNEL_CAT(FUNC_ZCONVOLVE_ACCUMULATE, suffix), \
+    PFFFT_KERNEL_CAT(FUNC_ZCONVOLVE_NO_ACCU, suffix),    \
+    PFFFT_KERNEL_CAT(FUNC_VALIDATE_SIMD_A, suffix),      \
+    PFFFT_KERNEL_CAT(FUNC_VALIDATE_SIMD_EX, suffix)      \
+  }
+
+/* indexed by PFFFT_CPU_* */
+static const KERNEL_STRUCT VAR_KERNELS[] = {
+  KERNEL_TABLE(_sse),
+  KERNEL_TABLE(_avx2),
+  KERNEL_TABLE(_avx512)
+};
+
+/* set by FUNC_SELECT_SIMD_ARCH, 0 for the automatic choice */
+static const KERNEL_STRUCT *VAR_SELECTED_KERNEL = 0;
+
+static const KERNEL_STRUCT *FUNC_CURRENT_KERNEL() {
+  const KERNEL_STRUCT *selected = (const KERNEL_STRUCT *)PFFFT_LOAD_PTR(&VAR_SELECTED_KERNEL);
+  return selected ? selected : &VAR_KERNELS[pffft_cpu_support()];
+}
+
+struct SETUP_STRUCT {
+  const KERNEL_STRUCT *kernel;
+  KERNEL_SETUP_STRUCT *setup;
+};
+
+/* the wider kernels need larger multiples of the sizes, a size that is
+   only valid for narrower vectors gets the widest kernel that takes it */
+SETUP_STRUCT *FUNC_NEW_SETUP(int N, pffft_transform_t transform) {
+  const KERNEL_STRUCT *kernel = FUNC_CURRENT_KERNEL();
+  KERNEL_SETUP_STRUCT *setup = kernel->new_setup(N, transform);
+  SETUP_STRUCT *s;
+  while (!setup && kernel != VAR_KERNELS) {
+    --kernel;
+    setup = kernel->new_setup(N, transform);
+  }
+  if (!setup)
+    return 0;
+  s = (SETUP_STRUCT*)malloc(sizeof(SETUP_STRUCT));
+  if (!s) {
+    kernel->destroy_setup(setup);
+    return 0;
+  }
+  s->kernel = kernel;
+  s->setup = setup;
+  return s;
+}
+
+void FUNC_DESTROY(SETUP_STRUCT *s) {
+  if (!s)
+    return;
+  s->kernel->destroy_setup(s->setup);
+  free(s);
+}
+
+void FUNC_TRANSFORM_UNORDRD(SETUP_STRUCT *s, const float *input, float *output, float *work, pffft_direction_t direction) {
+  s->kernel->transform(s->setup, input, output, work, direction);
+}
+
+void FUNC_TRANSFORM_ORDERED(SETUP_STRUCT *s, const float *input, float *output, float *work, pffft_direction_t direction) {
+  s->kernel->transform_ordered(s->setup, input, output, work, direction);
+}
+
+void FUNC_ZREORDER(SETUP_STRUCT *s, const float *input, float *output, pffft_direction_t direction) {
+  s->kernel->zreorder(s->setup, input, output, direction);
+}
+
+void FUNC_ZCONVOLVE_ACCUMULATE(SETUP_STRUCT *s, const float *dft_a, const float *dft_b, float *dft_ab, float scaling) {
+  s->kernel->zconvolve_accumulate(s->setup, dft_a, dft_b, dft_ab, scaling);
+}
+
+void FUNC_ZCONVOLVE_NO_ACCU(SETUP_STRUCT *s, const float *dft_a, const float *dft_b, float *dft_ab, float scaling) {
+  s->kernel->zconvolve_no_accu(s->setup, dft_a, dft_b, dft_ab, scaling);
+}
+
+const char *FUNC_SIMD_ARCH() { return FUNC_CURRENT_KERNEL()->simd_arch(); }
+const char *FUNC_SETUP_SIMD_ARCH(const SETUP_STRUCT *s) { return s->kernel->simd_arch(); }
+
+int FUNC_SELECT_SIMD_ARCH(const char *arch) {
+  int k;
+  if (!arch) {
+    PFFFT_STORE_PTR(&VAR_SELECTED_KERNEL, (const KERNEL_STRUCT *)0);
+    return 1;
+  }
+  for (k = 0; k <= pffft_cpu_support(); ++k) {
+    if (strcmp(arch, VAR_KERNELS[k].simd_arch()) == 0) {
+      PFFFT_STORE_PTR(&VAR_SELECTED_KERNEL, &VAR_KERNELS[k]);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+void FUNC_VALIDATE_SIMD_A() { FUNC_CURRENT_KERNEL()->validate_simd(); }
+int FUNC_VALIDATE_SIMD_EX(FILE *DbgOut) { return FUNC_CURRENT_KERNEL()->validate_simd_ex(DbgOut); }
+
+int FUNC_SIMD_SIZE() { return FUNC_CURRENT_KERNEL()->simd_size(); }
+
+/* the sizes of the narrowest kernel, FUNC_NEW_SETUP falls back to it */
+int FUNC_MIN_FFT_SIZE(pffft_transform_t transform) { return PFFFT_KERNEL_CAT(FUNC_MIN_FFT_SIZE, _sse)(transform); }
+int FUNC_IS_VALID_SIZE(int N, pffft_transform_t cplx) { return PFFFT_KERNEL_CAT(FUNC_IS_VALID_SIZE, _sse)(N, cplx); }
+int FUNC_NEAREST_SIZE(int N, pffft_transform_t cplx, int higher) {
+  return PFFFT_KERNEL_CAT(FUNC_NEAREST_SIZE, _sse)(N, cplx, higher);
+}
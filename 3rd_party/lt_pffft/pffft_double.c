@@ -90,11 +90,13 @@
 #  define NEVER_INLINE(return_type) return_type __attribute__ ((noinline))
 #  define RESTRICT __restrict
 #  define VLA_ARRAY_ON_STACK(type__, varname__, size__) type__ varname__[size__];
+#  define UNROLL_LOOP _Pragma("GCC unroll 16")
 #elif defined(COMPILER_MSVC)
 #  define ALWAYS_INLINE(return_type) __forceinline return_type
 #  define NEVER_INLINE(return_type) __declspec(noinline) return_type
 #  define RESTRICT __restrict
 #  define VLA_ARRAY_ON_STACK(type__, varname__, size__) type__ *varname__ = (type__*)_alloca(size__ * sizeof(type__))
+#  define UNROLL_LOOP
 #endif
 
 
@@ -109,34 +111,47 @@
 */
 #include "simd/pf_double.h"
 
+/*
+   With PFFFT_KERNEL_SUFFIX defined this file builds one kernel for the
+   runtime dispatch in pffft_dispatch.c: every symbol gets the suffix,
+   and the setup is the kernel's own struct which the dispatching
+   PFFFTD_Setup wraps. See pffft_kernels.h.
+*/
+#ifdef PFFFT_KERNEL_SUFFIX
+#  include "pffft_kernels.h"
+#  define SETUP_STRUCT             PFFFTD_Kernel_Setup
+#else
+#  define PFFFT_KERNEL(name)       name
+#  define SETUP_STRUCT             PFFFTD_Setup
+#endif
+
 /* have code comparable with this definition */
 #define float double
-#define SETUP_STRUCT               PFFFTD_Setup
-#define FUNC_NEW_SETUP             pffftd_new_setup
-#define FUNC_DESTROY               pffftd_destroy_setup
-#define FUNC_TRANSFORM_UNORDRD     pffftd_transform
-#define FUNC_TRANSFORM_ORDERED     pffftd_transform_ordered
-#define FUNC_ZREORDER              pffftd_zreorder
-#define FUNC_ZCONVOLVE_ACCUMULATE  pffftd_zconvolve_accumulate
-#define FUNC_ZCONVOLVE_NO_ACCU     pffftd_zconvolve_no_accu
+#define FUNC_NEW_SETUP             PFFFT_KERNEL(pffftd_new_setup)
+#define FUNC_DESTROY               PFFFT_KERNEL(pffftd_destroy_setup)
+#define FUNC_TRANSFORM_UNORDRD     PFFFT_KERNEL(pffftd_transform)
+#define FUNC_TRANSFORM_ORDERED     PFFFT_KERNEL(pffftd_transform_ordered)
+#define FUNC_ZREORDER              PFFFT_KERNEL(pffftd_zreorder)
+#define FUNC_ZCONVOLVE_ACCUMULATE  PFFFT_KERNEL(pffftd_zconvolve_accumulate)
+#define FUNC_ZCONVOLVE_NO_ACCU     PFFFT_KERNEL(pffftd_zconvolve_no_accu)
 
 #define FUNC_ALIGNED_MALLOC        pffftd_aligned_malloc
 #define FUNC_ALIGNED_FREE          pffftd_aligned_free
-#define FUNC_SIMD_SIZE             pffftd_simd_size
-#define FUNC_MIN_FFT_SIZE          pffftd_min_fft_size
-#define FUNC_IS_VALID_SIZE         pffftd_is_valid_size
-#define FUNC_NEAREST_SIZE          pffftd_nearest_transform_size
-#define FUNC_SIMD_ARCH             pffftd_simd_arch
-#define FUNC_VALIDATE_SIMD_A       validate_pffftd_simd
-#define FUNC_VALIDATE_SIMD_EX      validate_pffftd_simd_ex
-
-#define FUNC_CPLX_FINALIZE         pffftd_cplx_finalize
-#define FUNC_CPLX_PREPROCESS       pffftd_cplx_preprocess
-#define FUNC_REAL_PREPROCESS_4X4   pffftd_real_preprocess_4x4
-#define FUNC_REAL_PREPROCESS       pffftd_real_preprocess
-#define FUNC_REAL_FINALIZE_4X4     pffftd_real_finalize_4x4
-#define FUNC_REAL_FINALIZE         pffftd_real_finalize
-#define FUNC_TRANSFORM_INTERNAL    pffftd_transform_internal
+#define FUNC_SIMD_SIZE             PFFFT_KERNEL(pffftd_simd_size)
+#define FUNC_MIN_FFT_SIZE          PFFFT_KERNEL(pffftd_min_fft_size)
+#define FUNC_IS_VALID_SIZE         PFFFT_KERNEL(pffftd_is_valid_size)
+#define FUNC_NEAREST_SIZE          PFFFT_KERNEL(pffftd_nearest_transform_size)
+#define FUNC_SIMD_ARCH             PFFFT_KERNEL(pffftd_simd_arch)
+#define FUNC_VALIDATE_SIMD_A       PFFFT_KERNEL(validate_pffftd_simd)
+#define FUNC_VALIDATE_SIMD_EX      PFFFT_KERNEL(validate_pffftd_simd_ex)
+
+#define FUNC_CPLX_FINALIZE         PFFFT_KERNEL(pffftd_cplx_finalize)
+#define FUNC_CPLX_PREPROCESS       PFFFT_KERNEL(pffftd_cplx_preprocess)
+#define FUNC_REAL_PREPROCESS_4X4   PFFFT_KERNEL(pffftd_real_preprocess_4x4)
+#define FUNC_REAL_PREPROCESS       PFFFT_KERNEL(pffftd_real_preprocess)
+#define FUNC_REAL_FINALIZE_4X4     PFFFT_KERNEL(pffftd_real_finalize_4x4)
+#define FUNC_REAL_FINALIZE         PFFFT_KERNEL(pffftd_real_finalize)
+#define FUNC_TRANSFORM_INTERNAL    PFFFT_KERNEL(pffftd_transform_internal)
 
 #define FUNC_COS  cos
 #define FUNC_SIN  sin
@@ -144,4 +159,10 @@
 
 #include "pffft_priv_impl.h"
 
+#ifndef PFFFT_KERNEL_SUFFIX
+/* only one kernel without the runtime dispatch */
+int pffftd_select_simd_arch(const char *arch) { return !arch || strcmp(arch, VARCH) == 0; }
+const char *pffftd_setup_simd_arch(const PFFFTD_Setup *setup) { (void)setup; return VARCH; }
+#endif
+
 
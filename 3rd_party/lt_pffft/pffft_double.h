@@ -69,9 +69,13 @@
    144, 160, etc are all acceptable lengths). Performance is best for
    128<=N<=8192.
 
+   - the AVX-512 backend uses 8 element vectors, for it the lengths are
+   multiples of 128 for real and 64 for complex transforms. The runtime
+   dispatch falls back to a narrower kernel for the others.
+
    - all (double*) pointers in the functions below are expected to
    have an "simd-compatible" alignment, that is 32 bytes on x86 and
-   powerpc CPUs.
+   powerpc CPUs, 64 bytes with AVX-512.
   
    You can allocate such buffers with the functions
    pffft_aligned_malloc / pffft_aligned_free (or with stuff like
@@ -185,12 +189,28 @@ extern "C" {
   */
   void pffftd_zconvolve_no_accu(PFFFTD_Setup *setup, const double *dft_a, const double *dft_b, double*dft_ab, double scaling);
 
-  /* return 4 or 1 wether support AVX instructions was enabled when building pffft-double.c */
+  /* return the number of doubles per vector, 8 with AVX-512, 4 with AVX/SSE2/NEON and 1 without SIMD,
+     with the runtime dispatch of the kernel pffftd_new_setup currently picks */
   int pffftd_simd_size();
 
-  /* return string identifier of used architecture (AVX/..) */
+  /* return string identifier of used architecture (AVX/..),
+     with the runtime dispatch the one pffftd_new_setup currently picks */
   const char * pffftd_simd_arch();
 
+  /* return string identifier of the architecture that the setup uses,
+     with the runtime dispatch the kernel it was created with */
+  const char * pffftd_setup_simd_arch(const PFFFTD_Setup *setup);
+
+  /*
+    x86-64 builds with the runtime dispatch contain SSE2, AVX2 and AVX-512
+    kernels, and pffftd_new_setup picks the widest one the CPU supports.
+    This forces the kernel for later setups by its pffftd_simd_arch()
+    name, NULL goes back to the automatic choice. Returns 0 if that
+    kernel is not built or not supported by the CPU. Meant for testing,
+    it may be called from any thread. Existing setups keep their kernel.
+  */
+  int pffftd_select_simd_arch(const char *arch);
+
   /* simple helper to get minimum possible fft size */
   int pffftd_min_fft_size(pffft_transform_t transform);
 
@@ -220,8 +240,8 @@ extern "C" {
 
   /*
     the double buffers must have the correct alignment (32-byte boundary
-    on intel and powerpc). This function may be used to obtain such
-    correctly aligned buffers.  
+    on intel and powerpc, 64 with AVX-512). This function may be used to
+    obtain such correctly aligned buffers, they are aligned to 64 bytes.  
   */
   void *pffftd_aligned_malloc(size_t nb_bytes);
   void *pffft_aligned_malloc(size_t nb_bytes);
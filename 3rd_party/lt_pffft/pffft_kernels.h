@@ -0,0 +1,78 @@
+/*
+   Kernels of the runtime SIMD dispatch on x86-64.
+
+   kernels/ builds pffft.c and pffft_double.c once per instruction set,
+   with PFFFT_KERNEL_SUFFIX appended to every symbol. pffft_dispatch.c
+   picks one of them in pffft_new_setup and provides the public pffft_
+   and pffftd_ functions.
+
+   The kernel setups are separate structs, the public PFFFT_Setup and
+   PFFFTD_Setup wrap one together with the kernel that created it.
+*/
+
+#ifndef PFFFT_KERNELS_H
+#define PFFFT_KERNELS_H
+
+#include "pffft.h"
+#include "pffft_double.h"
+
+#include <stdio.h>
+
+#define PFFFT_KERNEL_CAT_(name, suffix)  name##suffix
+#define PFFFT_KERNEL_CAT(name, suffix)   PFFFT_KERNEL_CAT_(name, suffix)
+#define PFFFT_KERNEL(name)               PFFFT_KERNEL_CAT(name, PFFFT_KERNEL_SUFFIX)
+
+typedef struct PFFFT_Kernel_Setup PFFFT_Kernel_Setup;
+typedef struct PFFFTD_Kernel_Setup PFFFTD_Kernel_Setup;
+
+#define PFFFT_DECLARE_KERNEL(suffix)                                                                  \
+  const char *pffft_simd_arch##suffix();                                                             \
+  int pffft_simd_size##suffix();                                                                     \
+  int pffft_min_fft_size##suffix(pffft_transform_t transform);                                       \
+  int pffft_is_valid_size##suffix(int N, pffft_transform_t cplx);                                    \
+  int pffft_nearest_transform_size##suffix(int N, pffft_transform_t cplx, int higher);               \
+  PFFFT_Kernel_Setup *pffft_new_setup##suffix(int N, pffft_transform_t transform);                   \
+  void pffft_destroy_setup##suffix(PFFFT_Kernel_Setup *setup);                                       \
+  void pffft_transform##suffix(PFFFT_Kernel_Setup *setup, const float *input, float *output,         \
+                               float *work, pffft_direction_t direction);                            \
+  void pffft_transform_ordered##suffix(PFFFT_Kernel_Setup *setup, const float *input, float *output, \
+                                       float *work, pffft_direction_t direction);                    \
+  void pffft_zreorder##suffix(PFFFT_Kernel_Setup *setup, const float *input, float *output,          \
+                              pffft_direction_t direction);                                          \
+  void pffft_zconvolve_accumulate##suffix(PFFFT_Kernel_Setup *setup, const float *dft_a,             \
+                                          const float *dft_b, float *dft_ab, float scaling);         \
+  void pffft_zconvolve_no_accu##suffix(PFFFT_Kernel_Setup *setup, const float *dft_a,                \
+                                       const float *dft_b, float *dft_ab, float scaling);            \
+  void validate_pffft_simd##suffix();                                                                \
+  int validate_pffft_simd_ex##suffix(FILE *DbgOut);
+
+#define PFFFTD_DECLARE_KERNEL(suffix)                                                                     \
+  const char *pffftd_simd_arch##suffix();                                                                \
+  int pffftd_simd_size##suffix();                                                                        \
+  int pffftd_min_fft_size##suffix(pffft_transform_t transform);                                          \
+  int pffftd_is_valid_size##suffix(int N, pffft_transform_t cplx);                                       \
+  int pffftd_nearest_transform_size##suffix(int N, pffft_transform_t cplx, int higher);                  \
+  PFFFTD_Kernel_Setup *pffftd_new_setup##suffix(int N, pffft_transform_t transform);                     \
+  void pffftd_destroy_setup##suffix(PFFFTD_Kernel_Setup *setup);                                         \
+  void pffftd_transform##suffix(PFFFTD_Kernel_Setup *setup, const double *input, double *output,         \
+                                double *work, pffft_direction_t direction);                              \
+  void pffftd_transform_ordered##suffix(PFFFTD_Kernel_Setup *setup, const double *input, double *output, \
+                                        double *work, pffft_direction_t direction);                      \
+  void pffftd_zreorder##suffix(PFFFTD_Kernel_Setup *setup, const double *input, double *output,          \
+                               pffft_direction_t direction);                                             \
+  void pffftd_zconvolve_accumulate##suffix(PFFFTD_Kernel_Setup *setup, const double *dft_a,              \
+                                           const double *dft_b, double *dft_ab, double scaling);         \
+  void pffftd_zconvolve_no_accu##suffix(PFFFTD_Kernel_Setup *setup, const double *dft_a,                 \
+                                        const double *dft_b, double *dft_ab, double scaling);            \
+  void validate_pffftd_simd##suffix();                                                                   \
+  int validate_pffftd_simd_ex##suffix(FILE *DbgOut);
+
+PFFFT_DECLARE_KERNEL(_sse)
+PFFFT_DECLARE_KERNEL(_avx2)
+PFFFT_DECLARE_KERNEL(_avx512)
+
+PFFFTD_DECLARE_KERNEL(_sse)
+PFFFTD_DECLARE_KERNEL(_avx2)
+PFFFTD_DECLARE_KERNEL(_avx512)
+
+#endif /* PFFFT_KERNELS_H */
@@ -1050,6 +1050,7 @@ struct SETUP_STRUCT {
   v4sf *data;     /* allocated room for twiddle coefs */
   float *e;       /* points into 'data', N/4*3 elements */
   float *twiddle; /* points into 'data', N/4 elements */
+  float *edge;    /* points into 'data' after 'twiddle' if SIMD_SZ > 4, cos and sin of pi*k/SIMD_SZ, k < 2*SIMD_SZ */
 };
 
 SETUP_STRUCT *FUNC_NEW_SETUP(int N, pffft_transform_t transform) {
@@ -1066,9 +1067,18 @@ SETUP_STRUCT *FUNC_NEW_SETUP(int N, pffft_transform_t transform) {
   s->transform = transform;  
   /* nb of complex simd vectors */
   s->Ncvec = (transform == PFFFT_REAL ? N/2 : N)/SIMD_SZ;
-  s->data = (v4sf*)FUNC_ALIGNED_MALLOC(2*s->Ncvec * sizeof(v4sf));
+  s->data = (v4sf*)FUNC_ALIGNED_MALLOC(2*s->Ncvec * sizeof(v4sf) + (SIMD_SZ > 4 ? 4*SIMD_SZ*sizeof(float) : 0));
   s->e = (float*)s->data;
   s->twiddle = (float*)(s->data + (2*s->Ncvec*(SIMD_SZ-1))/SIMD_SZ);  
+  s->edge = 0;
+#if ( SIMD_SZ > 4 )
+  s->edge = (float*)(s->data + 2*s->Ncvec);
+  for (k=0; k < 2*SIMD_SZ; ++k) {
+    float A = (float)M_PI*k / SIMD_SZ;
+    s->edge[k] = FUNC_COS(A);
+    s->edge[2*SIMD_SZ + k] = FUNC_SIN(A);
+  }
+#endif
 
   if (transform == PFFFT_REAL) {
     for (k=0; k < s->Ncvec; ++k) {
@@ -1076,8 +1086,8 @@ SETUP_STRUCT *FUNC_NEW_SETUP(int N, pffft_transform_t transform) {
       int j = k%SIMD_SZ;
       for (m=0; m < SIMD_SZ-1; ++m) {
         float A = -2*(float)M_PI*(m+1)*k / N;
-        s->e[(2*(i*3 + m) + 0) * SIMD_SZ + j] = FUNC_COS(A);
-        s->e[(2*(i*3 + m) + 1) * SIMD_SZ + j] = FUNC_SIN(A);
+        s->e[(2*(i*(SIMD_SZ-1) + m) + 0) * SIMD_SZ + j] = FUNC_COS(A);
+        s->e[(2*(i*(SIMD_SZ-1) + m) + 1) * SIMD_SZ + j] = FUNC_SIN(A);
       }
     }
     rffti1_ps(N/SIMD_SZ, s->twiddle, s->ifac);
@@ -1087,8 +1097,8 @@ SETUP_STRUCT *FUNC_NEW_SETUP(int N, pffft_transform_t transform) {
       int j = k%SIMD_SZ;
       for (m=0; m < SIMD_SZ-1; ++m) {
         float A = -2*(float)M_PI*(m+1)*k / N;
-        s->e[(2*(i*3 + m) + 0)*SIMD_SZ + j] = FUNC_COS(A);
-        s->e[(2*(i*3 + m) + 1)*SIMD_SZ + j] = FUNC_SIN(A);
+        s->e[(2*(i*(SIMD_SZ-1) + m) + 0)*SIMD_SZ + j] = FUNC_COS(A);
+        s->e[(2*(i*(SIMD_SZ-1) + m) + 1)*SIMD_SZ + j] = FUNC_SIN(A);
       }
     }
     cffti1_ps(N/SIMD_SZ, s->twiddle, s->ifac);
@@ -1184,10 +1194,11 @@ void FUNC_ZREORDER(SETUP_STRUCT *setup, const float *in, float *out, pffft_direc
   }
 }
 
-void FUNC_CPLX_FINALIZE(int Ncvec, const v4sf *in, v4sf *out, const v4sf *e) {
+void FUNC_CPLX_FINALIZE(int Ncvec, const v4sf *in, v4sf *out, const v4sf *e, const float *edge) {
   int k, dk = Ncvec/SIMD_SZ; /* number of 4x4 matrix blocks */
   v4sf r0, i0, r1, i1, r2, i2, r3, i3;
   v4sf sr0, dr0, sr1, dr1, si0, di0, si1, di1;
+  (void)edge;
   assert(in != out);
   for (k=0; k < dk; ++k) {    
     r0 = in[8*k+0]; i0 = in[8*k+1];
@@ -1228,10 +1239,11 @@ void FUNC_CPLX_FINALIZE(int Ncvec, const v4sf *in, v4sf *out, const v4sf *e) {
   }
 }
 
-void FUNC_CPLX_PREPROCESS(int Ncvec, const v4sf *in, v4sf *out, const v4sf *e) {
+void FUNC_CPLX_PREPROCESS(int Ncvec, const v4sf *in, v4sf *out, const v4sf *e, const float *edge) {
   int k, dk = Ncvec/SIMD_SZ; /* number of 4x4 matrix blocks */
   v4sf r0, i0, r1, i1, r2, i2, r3, i3;
   v4sf sr0, dr0, sr1, dr1, si0, di0, si1, di1;
+  (void)edge;
   assert(in != out);
   for (k=0; k < dk; ++k) {    
     r0 = in[8*k+0]; i0 = in[8*k+1];
@@ -1319,7 +1331,7 @@ static ALWAYS_INLINE(void) FUNC_REAL_FINALIZE_4X4(const v4sf *in0, const v4sf *i
 
 }
 
-static NEVER_INLINE(void) FUNC_REAL_FINALIZE(int Ncvec, const v4sf *in, v4sf *out, const v4sf *e) {
+static NEVER_INLINE(void) FUNC_REAL_FINALIZE(int Ncvec, const v4sf *in, v4sf *out, const v4sf *e, const float *edge) {
   int k, dk = Ncvec/SIMD_SZ; /* number of 4x4 matrix blocks */
   /* fftpack order is f0r f1r f1i f2r f2i ... f(n-1)r f(n-1)i f(n)r */
 
@@ -1328,6 +1340,7 @@ static NEVER_INLINE(void) FUNC_REAL_FINALIZE(int Ncvec, const v4sf *in, v4sf *ou
   float xr0, xi0, xr1, xi1, xr2, xi2, xr3, xi3;
   static const float s = (float)M_SQRT2/2;
 
+  (void)edge;
   cr.v = in[0]; ci.v = in[Ncvec*2-1];
   assert(in != out);
   FUNC_REAL_FINALIZE_4X4(&zero, &zero, in+1, e, out);
@@ -1412,13 +1425,14 @@ static ALWAYS_INLINE(void) FUNC_REAL_PREPROCESS_4X4(const v4sf *in,
   *out++ = i3;
 }
 
-static NEVER_INLINE(void) FUNC_REAL_PREPROCESS(int Ncvec, const v4sf *in, v4sf *out, const v4sf *e) {
+static NEVER_INLINE(void) FUNC_REAL_PREPROCESS(int Ncvec, const v4sf *in, v4sf *out, const v4sf *e, const float *edge) {
   int k, dk = Ncvec/SIMD_SZ; /* number of 4x4 matrix blocks */
   /* fftpack order is f0r f1r f1i f2r f2i ... f(n-1)r f(n-1)i f(n)r */
 
   v4sf_union Xr, Xi, *uout = (v4sf_union*)out;
   float cr0, ci0, cr1, ci1, cr2, ci2, cr3, ci3;
   static const float s = (float)M_SQRT2;
+  (void)edge;
   assert(in != out);
   for (k=0; k < 4; ++k) {
     Xr.f[k] = ((float*)in)[8*k];
@@ -1453,6 +1467,261 @@ static NEVER_INLINE(void) FUNC_REAL_PREPROCESS(int Ncvec, const v4sf *in, v4sf *
   ci3=-s*(Xr.f[1]-Xr.f[3]) - s*(Xi.f[1]+Xi.f[3]); uout[2*Ncvec-1].f[3] = ci3;
 }
 
+#elif ( SIMD_SZ > 4 )
+
+/*
+  The same layout for wider vectors. Lane j of the lane transforms
+  holds the samples j, j+SIMD_SZ, j+2*SIMD_SZ, .. and a block of
+  SIMD_SZ bins of all lanes is combined with a transpose and a
+  SIMD_SZ point DFT across the vectors. The loops over the vectors of
+  a block are unrolled, so that the blocks stay in registers.
+*/
+
+/* in-place DFT of length SIMD_SZ across r[] and i[], not scaled. 'edge'
+   holds the twiddles, see SETUP_STRUCT */
+static ALWAYS_INLINE(void) dft_vectors(v4sf *r, v4sf *i, const float *edge, int backward) {
+  int k, j, b, m, len;
+  v4sf rr[SIMD_SZ], ri[SIMD_SZ];
+  UNROLL_LOOP
+  for (k=0; k < SIMD_SZ; ++k) { rr[k] = r[k]; ri[k] = i[k]; }
+  UNROLL_LOOP
+  for (k=0; k < SIMD_SZ; ++k) { /* bit reversed order */
+    j = 0;
+    UNROLL_LOOP
+    for (b=SIMD_SZ/2, m=k; b; b /= 2, m /= 2) j |= (m & 1) ? b : 0;
+    r[k] = rr[j]; i[k] = ri[j];
+  }
+  UNROLL_LOOP
+  for (len=2; len <= SIMD_SZ; len *= 2) {
+    UNROLL_LOOP
+    for (m=0; m < len/2; ++m) {
+      const int n = m*2*SIMD_SZ/len; /* twiddle exp(-+i*pi*n/SIMD_SZ) */
+      const v4sf c = LD_PS1(edge[n]), s = LD_PS1(edge[2*SIMD_SZ + n]);
+      UNROLL_LOOP
+      for (k=m; k < SIMD_SZ; k += len) {
+        v4sf tr = r[k + len/2], ti = i[k + len/2];
+        if (2*n == SIMD_SZ) { /* -i or +i */
+          v4sf t = tr;
+          if (backward) { tr = VSUB(VZERO(), ti); ti = t; }
+          else          { tr = ti; ti = VSUB(VZERO(), t); }
+        } else if (n) {
+          if (backward) { VCPLXMUL(tr, ti, c, s); }
+          else          { VCPLXMULCONJ(tr, ti, c, s); }
+        }
+        r[k + len/2] = VSUB(r[k], tr); i[k + len/2] = VSUB(i[k], ti);
+        r[k] = VADD(r[k], tr);         i[k] = VADD(i[k], ti);
+      }
+    }
+  }
+}
+
+void FUNC_ZREORDER(SETUP_STRUCT *setup, const float *in, float *out, pffft_direction_t direction) {
+  int k, t, m, N = setup->N, Ncvec = setup->Ncvec;
+  const v4sf *vin = (const v4sf*)in;
+  v4sf *vout = (v4sf*)out;
+  assert(in != out);
+  if (setup->transform == PFFFT_REAL) {
+    /* block k holds the bins SIMD_SZ*k+m + t*L and L-SIMD_SZ*k-m + t*L of
+       lane m, t < SIMD_SZ/2, and lane 0 of block 0 the bins L/2 + t*L
+       instead of the second, see FUNC_REAL_FINALIZE */
+    const int L = N/SIMD_SZ, dk = Ncvec/SIMD_SZ;
+    if (direction == PFFFT_FORWARD) {
+      const v4sf_union *uin = (const v4sf_union*)in;
+      for (k=0; k < dk; ++k) {
+        for (t=0; t < SIMD_SZ/2; ++t) {
+          const v4sf *b = vin + 2*SIMD_SZ*k + 4*t;
+          const int kk = t*L/SIMD_SZ + k;
+          INTERLEAVE2(b[0], b[1], vout[2*kk], vout[2*kk+1]);
+          if (k) {
+            float *o = out + 2*(t*L + L - SIMD_SZ*(k+1) + 1);
+            v4sf lo, hi;
+            INTERLEAVE2(b[2], b[3], lo, hi);
+            VSTORE_UNALIGNED(o, VREV_C(hi));
+            VSTORE_UNALIGNED(o + SIMD_SZ, VREV_C(lo));
+          }
+        }
+      }
+      for (t=0; t < SIMD_SZ/2; ++t) {
+        for (m=0; m < SIMD_SZ; ++m) {
+          const int c = t*L + (m ? L - m : L/2);
+          out[2*c] = uin[4*t+2].f[m]; out[2*c+1] = uin[4*t+3].f[m];
+        }
+      }
+    } else {
+      v4sf_union *uout = (v4sf_union*)out;
+      for (k=0; k < dk; ++k) {
+        for (t=0; t < SIMD_SZ/2; ++t) {
+          v4sf *b = vout + 2*SIMD_SZ*k + 4*t;
+          const int kk = t*L/SIMD_SZ + k;
+          UNINTERLEAVE2(vin[2*kk], vin[2*kk+1], b[0], b[1]);
+          if (k) {
+            const float *o = in + 2*(t*L + L - SIMD_SZ*(k+1) + 1);
+            v4sf lo = VREV_C(VLOAD_UNALIGNED(o + SIMD_SZ)), hi = VREV_C(VLOAD_UNALIGNED(o));
+            UNINTERLEAVE2(lo, hi, b[2], b[3]);
+          }
+        }
+      }
+      for (t=0; t < SIMD_SZ/2; ++t) {
+        for (m=0; m < SIMD_SZ; ++m) {
+          const int c = t*L + (m ? L - m : L/2);
+          uout[4*t+2].f[m] = in[2*c]; uout[4*t+3].f[m] = in[2*c+1];
+        }
+      }
+    }
+  } else {
+    if (direction == PFFFT_FORWARD) {
+      for (k=0; k < Ncvec; ++k) {
+        int kk = (k/SIMD_SZ) + (k%SIMD_SZ)*(Ncvec/SIMD_SZ);
+        INTERLEAVE2(vin[k*2], vin[k*2+1], vout[kk*2], vout[kk*2+1]);
+      }
+    } else {
+      for (k=0; k < Ncvec; ++k) {
+        int kk = (k/SIMD_SZ) + (k%SIMD_SZ)*(Ncvec/SIMD_SZ);
+        UNINTERLEAVE2(vin[kk*2], vin[kk*2+1], vout[k*2], vout[k*2+1]);
+      }
+    }
+  }
+}
+
+void FUNC_CPLX_FINALIZE(int Ncvec, const v4sf *in, v4sf *out, const v4sf *e, const float *edge) {
+  int k, j, dk = Ncvec/SIMD_SZ; /* number of SIMD_SZ x SIMD_SZ matrix blocks */
+  v4sf r[SIMD_SZ], i[SIMD_SZ];
+  assert(in != out);
+  for (k=0; k < dk; ++k) {
+    UNROLL_LOOP
+    for (j=0; j < SIMD_SZ; ++j) { r[j] = in[2*j]; i[j] = in[2*j+1]; }
+    VTRANSPOSE(r);
+    VTRANSPOSE(i);
+    UNROLL_LOOP
+    for (j=1; j < SIMD_SZ; ++j) VCPLXMUL(r[j], i[j], e[2*j-2], e[2*j-1]);
+    dft_vectors(r, i, edge, 0);
+    UNROLL_LOOP
+    for (j=0; j < SIMD_SZ; ++j) { out[2*j] = r[j]; out[2*j+1] = i[j]; }
+    in += 2*SIMD_SZ; out += 2*SIMD_SZ; e += 2*(SIMD_SZ-1);
+  }
+}
+
+void FUNC_CPLX_PREPROCESS(int Ncvec, const v4sf *in, v4sf *out, const v4sf *e, const float *edge) {
+  int k, j, dk = Ncvec/SIMD_SZ; /* number of SIMD_SZ x SIMD_SZ matrix blocks */
+  v4sf r[SIMD_SZ], i[SIMD_SZ];
+  assert(in != out);
+  for (k=0; k < dk; ++k) {
+    UNROLL_LOOP
+    for (j=0; j < SIMD_SZ; ++j) { r[j] = in[2*j]; i[j] = in[2*j+1]; }
+    dft_vectors(r, i, edge, 1);
+    UNROLL_LOOP
+    for (j=1; j < SIMD_SZ; ++j) VCPLXMULCONJ(r[j], i[j], e[2*j-2], e[2*j-1]);
+    VTRANSPOSE(r);
+    VTRANSPOSE(i);
+    UNROLL_LOOP
+    for (j=0; j < SIMD_SZ; ++j) { out[2*j] = r[j]; out[2*j+1] = i[j]; }
+    in += 2*SIMD_SZ; out += 2*SIMD_SZ; e += 2*(SIMD_SZ-1);
+  }
+}
+
+static NEVER_INLINE(void) FUNC_REAL_FINALIZE(int Ncvec, const v4sf *in, v4sf *out, const v4sf *e, const float *edge) {
+  int k, j, t, dk = Ncvec/SIMD_SZ; /* number of SIMD_SZ x SIMD_SZ matrix blocks */
+  /* fftpack order is f0r f1r f1i f2r f2i ... f(n-1)r f(n-1)i f(n)r */
+  v4sf r[SIMD_SZ], i[SIMD_SZ];
+  v4sf_union cr, ci, *uout = (v4sf_union*)out;
+  float xr, xi, yr, yi;
+
+  cr.v = in[0]; ci.v = in[Ncvec*2-1];
+  assert(in != out);
+  for (k=0; k < dk; ++k) {
+    /* bin 0 of the lanes is not in this order, lane 0 of block 0 is set below */
+    r[0] = k ? in[-1] : VZERO();
+    i[0] = k ? in[0] : VZERO();
+    UNROLL_LOOP
+    for (j=1; j < SIMD_SZ; ++j) { r[j] = in[2*j-1]; i[j] = in[2*j]; }
+    VTRANSPOSE(r);
+    VTRANSPOSE(i);
+    UNROLL_LOOP
+    for (j=1; j < SIMD_SZ; ++j) VCPLXMUL(r[j], i[j], e[2*j-2], e[2*j-1]);
+    dft_vectors(r, i, edge, 0);
+    /* the upper half are negative frequencies, stored as the conjugated positive ones */
+    UNROLL_LOOP
+    for (t=0; t < SIMD_SZ/2; ++t) {
+      out[4*t+0] = r[t]; out[4*t+1] = i[t];
+      out[4*t+2] = r[SIMD_SZ-1-t]; out[4*t+3] = VSUB(VZERO(), i[SIMD_SZ-1-t]);
+    }
+    in += 2*SIMD_SZ; out += 2*SIMD_SZ; e += 2*(SIMD_SZ-1);
+  }
+
+  /* Xr(0) and Xr(N/2), and the bins t*N/SIMD_SZ and (2*t+1)*N/(2*SIMD_SZ)
+     from bin 0 (cr) and the nyquist bin (ci) of the lanes */
+  UNROLL_LOOP
+  for (t=0; t < SIMD_SZ/2; ++t) {
+    xr = xi = yr = yi = 0;
+    UNROLL_LOOP
+    for (j=0; j < SIMD_SZ; ++j) {
+      const int n = (2*j*t) % (2*SIMD_SZ), o = (j*(2*t+1)) % (2*SIMD_SZ);
+      xr += cr.f[j]*edge[n]; xi -= cr.f[j]*edge[2*SIMD_SZ + n];
+      yr += ci.f[j]*edge[o]; yi -= ci.f[j]*edge[2*SIMD_SZ + o];
+    }
+    if (t == 0) {
+      UNROLL_LOOP
+      for (j=0; j < SIMD_SZ; ++j) xi += (j & 1) ? -cr.f[j] : cr.f[j];
+    }
+    uout[4*t+0].f[0] = xr; uout[4*t+1].f[0] = xi;
+    uout[4*t+2].f[0] = yr; uout[4*t+3].f[0] = yi;
+  }
+}
+
+static NEVER_INLINE(void) FUNC_REAL_PREPROCESS(int Ncvec, const v4sf *in, v4sf *out, const v4sf *e, const float *edge) {
+  int k, j, t, dk = Ncvec/SIMD_SZ; /* number of SIMD_SZ x SIMD_SZ matrix blocks */
+  /* fftpack order is f0r f1r f1i f2r f2i ... f(n-1)r f(n-1)i f(n)r */
+  v4sf r[SIMD_SZ], i[SIMD_SZ];
+  const v4sf_union *uin = (const v4sf_union*)in;
+  v4sf_union *uout = (v4sf_union*)out;
+  float Xr[SIMD_SZ], Xi[SIMD_SZ], cr, ci;
+
+  assert(in != out);
+  for (k=0; k < SIMD_SZ; ++k) {
+    Xr[k] = uin[2*k].f[0];
+    Xi[k] = uin[2*k+1].f[0];
+  }
+
+  for (k=0; k < dk; ++k) {
+    UNROLL_LOOP
+    for (t=0; t < SIMD_SZ/2; ++t) {
+      r[t] = in[4*t+0]; i[t] = in[4*t+1];
+      r[SIMD_SZ-1-t] = in[4*t+2]; i[SIMD_SZ-1-t] = VSUB(VZERO(), in[4*t+3]);
+    }
+    dft_vectors(r, i, edge, 1);
+    UNROLL_LOOP
+    for (j=1; j < SIMD_SZ; ++j) VCPLXMULCONJ(r[j], i[j], e[2*j-2], e[2*j-1]);
+    VTRANSPOSE(r);
+    VTRANSPOSE(i);
+    if (k) { out[-1] = r[0]; out[0] = i[0]; }
+    UNROLL_LOOP
+    for (j=1; j < SIMD_SZ; ++j) { out[2*j-1] = r[j]; out[2*j] = i[j]; }
+    in += 2*SIMD_SZ; out += 2*SIMD_SZ; e += 2*(SIMD_SZ-1);
+  }
+
+  /* bin 0 and the nyquist bin of the lanes, the inverse of the end of FUNC_REAL_FINALIZE */
+  UNROLL_LOOP
+  for (j=0; j < SIMD_SZ; ++j) {
+    cr = Xr[0] + ((j & 1) ? -Xi[0] : Xi[0]);
+    ci = 0;
+    UNROLL_LOOP
+    for (t=1; t < SIMD_SZ/2; ++t) {
+      const int n = (2*j*t) % (2*SIMD_SZ);
+      cr += 2*(Xr[2*t]*edge[n] - Xi[2*t]*edge[2*SIMD_SZ + n]);
+    }
+    UNROLL_LOOP
+    for (t=0; t < SIMD_SZ/2; ++t) {
+      const int n = (j*(2*t+1)) % (2*SIMD_SZ);
+      ci += 2*(Xr[2*t+1]*edge[n] - Xi[2*t+1]*edge[2*SIMD_SZ + n]);
+    }
+    uout[0].f[j] = cr;
+    uout[2*Ncvec-1].f[j] = ci;
+  }
+}
+
+#endif /* SIMD_SZ > 4 */
+
+#if ( SIMD_SZ >= 4 )
 
 void FUNC_TRANSFORM_INTERNAL(SETUP_STRUCT *setup, const float *finput, float *foutput, v4sf *scratch,
                              pffft_direction_t direction, int ordered) {
@@ -1476,7 +1745,7 @@ void FUNC_TRANSFORM_INTERNAL(SETUP_STRUCT *setup, const float *finput, float *fo
     if (setup->transform == PFFFT_REAL) { 
       ib = (rfftf1_ps(Ncvec*2, vinput, buff[ib], buff[!ib],
                       setup->twiddle, &setup->ifac[0]) == buff[0] ? 0 : 1);      
-      FUNC_REAL_FINALIZE(Ncvec, buff[ib], buff[!ib], (v4sf*)setup->e);
+      FUNC_REAL_FINALIZE(Ncvec, buff[ib], buff[!ib], (v4sf*)setup->e, setup->edge);
     } else {
       v4sf *tmp = buff[ib];
       for (k=0; k < Ncvec; ++k) {
@@ -1484,7 +1753,7 @@ void FUNC_TRANSFORM_INTERNAL(SETUP_STRUCT *setup, const float *finput, float *fo
       }
       ib = (cfftf1_ps(Ncvec, buff[ib], buff[!ib], buff[ib], 
                       setup->twiddle, &setup->ifac[0], -1) == buff[0] ? 0 : 1);
-      FUNC_CPLX_FINALIZE(Ncvec, buff[ib], buff[!ib], (v4sf*)setup->e);
+      FUNC_CPLX_FINALIZE(Ncvec, buff[ib], buff[!ib], (v4sf*)setup->e, setup->edge);
     }
     if (ordered) {
       FUNC_ZREORDER(setup, (float*)buff[!ib], (float*)buff[ib], PFFFT_FORWARD);
@@ -1498,11 +1767,11 @@ void FUNC_TRANSFORM_INTERNAL(SETUP_STRUCT *setup, const float *finput, float *fo
       vinput = buff[ib]; ib = !ib;
     }
     if (setup->transform == PFFFT_REAL) {
-      FUNC_REAL_PREPROCESS(Ncvec, vinput, buff[ib], (v4sf*)setup->e);
+      FUNC_REAL_PREPROCESS(Ncvec, vinput, buff[ib], (v4sf*)setup->e, setup->edge);
       ib = (rfftb1_ps(Ncvec*2, buff[ib], buff[0], buff[1], 
                       setup->twiddle, &setup->ifac[0]) == buff[0] ? 0 : 1);
     } else {
-      FUNC_CPLX_PREPROCESS(Ncvec, vinput, buff[ib], (v4sf*)setup->e);
+      FUNC_CPLX_PREPROCESS(Ncvec, vinput, buff[ib], (v4sf*)setup->e, setup->edge);
       ib = (cfftf1_ps(Ncvec, buff[ib], buff[0], buff[1], 
                       setup->twiddle, &setup->ifac[0], +1) == buff[0] ? 0 : 1);
       for (k=0; k < Ncvec; ++k) {
@@ -1676,7 +1945,7 @@ void FUNC_ZCONVOLVE_NO_ACCU(SETUP_STRUCT *s, const float *a, const float *b, flo
 }
 
 
-#else  /* #if ( SIMD_SZ == 4 )   * !defined(PFFFT_SIMD_DISABLE) */
+#else  /* #if ( SIMD_SZ >= 4 )   * !defined(PFFFT_SIMD_DISABLE) */
 
 /* standard routine using scalar floats, without SIMD stuff. */
 
@@ -1802,7 +2071,7 @@ void pffft_zconvolve_no_accu_nosimd(SETUP_STRUCT *s, const float *a, const float
 }
 
 
-#endif /* #if ( SIMD_SZ == 4 )    * !defined(PFFFT_SIMD_DISABLE) */
+#endif /* #if ( SIMD_SZ >= 4 )    * !defined(PFFFT_SIMD_DISABLE) */
 
 
 void FUNC_TRANSFORM_UNORDRD(SETUP_STRUCT *setup, const float *input, float *output, float *work, pffft_direction_t direction) {
@@ -2224,6 +2493,7 @@ void FUNC_VALIDATE_SIMD_A()
 
 int FUNC_VALIDATE_SIMD_EX(FILE * DbgOut)
 {
+  (void)DbgOut;
   return -1;
 }
 
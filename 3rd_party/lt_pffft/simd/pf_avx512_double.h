@@ -0,0 +1,121 @@
+/*
+   Copyright (c) 2020  Dario Mambro ( dario.mambro@gmail.com )
+*/
+
+/* Copyright (c) 2013  Julien Pommier ( pommier@modartt.com )
+
+   Redistribution and use of the Software in source and binary forms,
+   with or without modification, is permitted provided that the
+   following conditions are met:
+
+   - Neither the names of NCAR's Computational and Information Systems
+   Laboratory, the University Corporation for Atmospheric Research,
+   nor the names of its sponsors or contributors may be used to
+   endorse or promote products derived from this Software without
+   specific prior written permission.
+
+   - Redistributions of source code must retain the above copyright
+   notices, this list of conditions, and the disclaimer below.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions, and the disclaimer below in the
+   documentation and/or other materials provided with the
+   distribution.
+
+   THIS SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+   EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE CONTRIBUTORS OR COPYRIGHT
+   HOLDERS BE LIABLE FOR ANY CLAIM, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS WITH THE
+   SOFTWARE.
+*/
+
+#ifndef PF_AVX512_DBL_H
+#define PF_AVX512_DBL_H
+
+/*
+  AVX-512 support macros for double, 8 doubles per vector
+*/
+#if !defined(SIMD_SZ) && !defined(PFFFT_SIMD_DISABLE) && defined(__AVX512F__)
+// #pragma message( __FILE__ ": AVX-512 double macros are defined" )
+
+#include <immintrin.h>
+typedef __m512d v4sf;
+
+/* 8 doubles by simd vector */
+#  define SIMD_SZ 8
+
+typedef union v4sf_union {
+  v4sf  v;
+  double f[SIMD_SZ];
+} v4sf_union;
+
+#  define VARCH "AVX-512"
+#  define VREQUIRES_ALIGN 1
+#  define VZERO() _mm512_setzero_pd()
+#  define VMUL(a,b) _mm512_mul_pd(a,b)
+#  define VADD(a,b) _mm512_add_pd(a,b)
+#  define VMADD(a,b,c) _mm512_fmadd_pd(a,b,c)
+#  define VSUB(a,b) _mm512_sub_pd(a,b)
+#  define LD_PS1(p) _mm512_set1_pd(p)
+#  define VLOAD_UNALIGNED(ptr)  _mm512_loadu_pd(ptr)
+#  define VLOAD_ALIGNED(ptr)    _mm512_load_pd(ptr)
+#  define VSTORE_UNALIGNED(ptr, v)  _mm512_storeu_pd(ptr, v)
+
+#  define VCPLXMUL(ar,ai,br,bi) { v4sf tmp; tmp=_mm512_mul_pd(ar,bi); ar=_mm512_fmsub_pd(ar,br,_mm512_mul_pd(ai,bi)); ai=_mm512_fmadd_pd(ai,br,tmp); }
+#  define VCPLXMULCONJ(ar,ai,br,bi) { v4sf tmp; tmp=_mm512_mul_pd(ar,bi); ar=_mm512_fmadd_pd(ar,br,_mm512_mul_pd(ai,bi)); ai=_mm512_fmsub_pd(ai,br,tmp); }
+
+/* INTERLEAVE2 (in1, in2, out1, out2) pseudo code:
+out1 = [ in1[0], in2[0], in1[1], in2[1], in1[2], in2[2], in1[3], in2[3] ]
+out2 = [ in1[4], in2[4], in1[5], in2[5], in1[6], in2[6], in1[7], in2[7] ]
+*/
+#  define INTERLEAVE2(in1, in2, out1, out2) {                                \
+    __m512d tmp__ = _mm512_permutex2var_pd(in1, _mm512_setr_epi64(0, 8, 1, 9, 2, 10, 3, 11), in2);  \
+    out2 = _mm512_permutex2var_pd(in1, _mm512_setr_epi64(4, 12, 5, 13, 6, 14, 7, 15), in2);          \
+    out1 = tmp__;                                                             \
+  }
+
+/* UNINTERLEAVE2 (in1, in2, out1, out2) pseudo code:
+out1 = [ in1[0], in1[2], in1[4], in1[6], in2[0], in2[2], in2[4], in2[6] ]
+out2 = [ in1[1], in1[3], in1[5], in1[7], in2[1], in2[3], in2[5], in2[7] ]
+*/
+#  define UNINTERLEAVE2(in1, in2, out1, out2) {                              \
+    __m512d tmp__ = _mm512_permutex2var_pd(in1, _mm512_setr_epi64(0, 2, 4, 6, 8, 10, 12, 14), in2);  \
+    out2 = _mm512_permutex2var_pd(in1, _mm512_setr_epi64(1, 3, 5, 7, 9, 11, 13, 15), in2);           \
+    out1 = tmp__;                                                             \
+  }
+
+/* transposes the 8x8 matrix in the array x[8] of vectors */
+#  define VTRANSPOSE(x) {                                                                       \
+    __m512d t__[8], u__[8];                                                                     \
+    int k__;                                                                                    \
+    UNROLL_LOOP                                                                                 \
+    for (k__ = 0; k__ < 8; k__ += 2) {                                                          \
+      t__[k__] = _mm512_unpacklo_pd(x[k__], x[k__+1]);                                          \
+      t__[k__+1] = _mm512_unpackhi_pd(x[k__], x[k__+1]);                                        \
+    }                                                                                           \
+    UNROLL_LOOP                                                                                 \
+    for (k__ = 0; k__ < 8; k__ += (k__ & 1) ? 3 : 1) {                                          \
+      u__[k__] = _mm512_shuffle_f64x2(t__[k__], t__[k__+2], _MM_SHUFFLE(2,0,2,0));              \
+      u__[k__+2] = _mm512_shuffle_f64x2(t__[k__], t__[k__+2], _MM_SHUFFLE(3,1,3,1));            \
+    }                                                                                           \
+    UNROLL_LOOP                                                                                 \
+    for (k__ = 0; k__ < 4; ++k__) {                                                             \
+      x[k__] = _mm512_shuffle_f64x2(u__[k__], u__[k__+4], _MM_SHUFFLE(2,0,2,0));                \
+      x[k__+4] = _mm512_shuffle_f64x2(u__[k__], u__[k__+4], _MM_SHUFFLE(3,1,3,1));              \
+    }                                                                                           \
+  }
+
+/* reverse/flip complex doubles */
+#  define VREV_C(a)    _mm512_shuffle_f64x2(a, a, _MM_SHUFFLE(0,1,2,3))
+
+#  define VALIGNED(ptr) ((((uintptr_t)(ptr)) & 0x3F) == 0)
+
+#else
+/* #pragma message( __FILE__ ": AVX-512 double macros are not defined" ) */
+#endif
+
+#endif /* PF_AVX512_DBL_H */
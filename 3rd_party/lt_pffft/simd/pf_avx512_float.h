@@ -0,0 +1,131 @@
+
+/* Copyright (c) 2013  Julien Pommier ( pommier@modartt.com )
+
+   Redistribution and use of the Software in source and binary forms,
+   with or without modification, is permitted provided that the
+   following conditions are met:
+
+   - Neither the names of NCAR's Computational and Information Systems
+   Laboratory, the University Corporation for Atmospheric Research,
+   nor the names of its sponsors or contributors may be used to
+   endorse or promote products derived from this Software without
+   specific prior written permission.
+
+   - Redistributions of source code must retain the above copyright
+   notices, this list of conditions, and the disclaimer below.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions, and the disclaimer below in the
+   documentation and/or other materials provided with the
+   distribution.
+
+   THIS SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+   EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE CONTRIBUTORS OR COPYRIGHT
+   HOLDERS BE LIABLE FOR ANY CLAIM, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS WITH THE
+   SOFTWARE.
+*/
+
+#ifndef PF_AVX512_FLT_H
+#define PF_AVX512_FLT_H
+
+/*
+  AVX-512 support macros for float, 16 floats per vector
+*/
+#if !defined(SIMD_SZ) && !defined(PFFFT_SIMD_DISABLE) && defined(__AVX512F__)
+// #pragma message( __FILE__ ": AVX-512 float macros are defined" )
+
+#include <immintrin.h>
+typedef __m512 v4sf;
+
+/* 16 floats by simd vector */
+#  define SIMD_SZ 16
+
+typedef union v4sf_union {
+  v4sf  v;
+  float f[SIMD_SZ];
+} v4sf_union;
+
+#  define VARCH "AVX-512"
+#  define VREQUIRES_ALIGN 1
+#  define VZERO() _mm512_setzero_ps()
+#  define VMUL(a,b) _mm512_mul_ps(a,b)
+#  define VADD(a,b) _mm512_add_ps(a,b)
+#  define VMADD(a,b,c) _mm512_fmadd_ps(a,b,c)
+#  define VSUB(a,b) _mm512_sub_ps(a,b)
+#  define LD_PS1(p) _mm512_set1_ps(p)
+#  define VLOAD_UNALIGNED(ptr)  _mm512_loadu_ps(ptr)
+#  define VLOAD_ALIGNED(ptr)    _mm512_load_ps(ptr)
+#  define VSTORE_UNALIGNED(ptr, v)  _mm512_storeu_ps(ptr, v)
+
+#  define VCPLXMUL(ar,ai,br,bi) { v4sf tmp; tmp=_mm512_mul_ps(ar,bi); ar=_mm512_fmsub_ps(ar,br,_mm512_mul_ps(ai,bi)); ai=_mm512_fmadd_ps(ai,br,tmp); }
+#  define VCPLXMULCONJ(ar,ai,br,bi) { v4sf tmp; tmp=_mm512_mul_ps(ar,bi); ar=_mm512_fmadd_ps(ar,br,_mm512_mul_ps(ai,bi)); ai=_mm512_fmsub_ps(ai,br,tmp); }
+
+/* INTERLEAVE2 (in1, in2, out1, out2) pseudo code:
+out1 = [ in1[0], in2[0], in1[1], in2[1], ... in1[7], in2[7] ]
+out2 = [ in1[8], in2[8], in1[9], in2[9], ... in1[15], in2[15] ]
+*/
+#  define INTERLEAVE2(in1, in2, out1, out2) {                                                       \
+    const __m512i lo__ = _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);     \
+    const __m512i hi__ = _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31); \
+    __m512 tmp__ = _mm512_permutex2var_ps(in1, lo__, in2);                                           \
+    out2 = _mm512_permutex2var_ps(in1, hi__, in2);                                                   \
+    out1 = tmp__;                                                                                    \
+  }
+
+/* UNINTERLEAVE2 (in1, in2, out1, out2) pseudo code:
+out1 = [ in1[0], in1[2], ... in1[14], in2[0], in2[2], ... in2[14] ]
+out2 = [ in1[1], in1[3], ... in1[15], in2[1], in2[3], ... in2[15] ]
+*/
+#  define UNINTERLEAVE2(in1, in2, out1, out2) {                                                       \
+    const __m512i even__ = _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30); \
+    const __m512i odd__ = _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31);  \
+    __m512 tmp__ = _mm512_permutex2var_ps(in1, even__, in2);                                           \
+    out2 = _mm512_permutex2var_ps(in1, odd__, in2);                                                    \
+    out1 = tmp__;                                                                                      \
+  }
+
+/* transposes the 16x16 matrix in the array x[16] of vectors */
+#  define VTRANSPOSE(x) {                                                                               \
+    __m512 t__[16];                                                                                     \
+    int k__;                                                                                            \
+    UNROLL_LOOP                                                                                         \
+    for (k__ = 0; k__ < 16; k__ += 2) {                                                                 \
+      t__[k__] = _mm512_unpacklo_ps(x[k__], x[k__+1]);                                                  \
+      t__[k__+1] = _mm512_unpackhi_ps(x[k__], x[k__+1]);                                                \
+    }                                                                                                   \
+    UNROLL_LOOP                                                                                         \
+    for (k__ = 0; k__ < 16; k__ += 4) {                                                                 \
+      x[k__] = _mm512_castpd_ps(_mm512_unpacklo_pd(_mm512_castps_pd(t__[k__]), _mm512_castps_pd(t__[k__+2])));   \
+      x[k__+1] = _mm512_castpd_ps(_mm512_unpackhi_pd(_mm512_castps_pd(t__[k__]), _mm512_castps_pd(t__[k__+2]))); \
+      x[k__+2] = _mm512_castpd_ps(_mm512_unpacklo_pd(_mm512_castps_pd(t__[k__+1]), _mm512_castps_pd(t__[k__+3]))); \
+      x[k__+3] = _mm512_castpd_ps(_mm512_unpackhi_pd(_mm512_castps_pd(t__[k__+1]), _mm512_castps_pd(t__[k__+3]))); \
+    }                                                                                                   \
+    UNROLL_LOOP                                                                                         \
+    for (k__ = 0; k__ < 4; ++k__) {                                                                     \
+      t__[k__] = _mm512_shuffle_f32x4(x[k__], x[k__+4], _MM_SHUFFLE(2,0,2,0));                          \
+      t__[k__+4] = _mm512_shuffle_f32x4(x[k__], x[k__+4], _MM_SHUFFLE(3,1,3,1));                        \
+      t__[k__+8] = _mm512_shuffle_f32x4(x[k__+8], x[k__+12], _MM_SHUFFLE(2,0,2,0));                     \
+      t__[k__+12] = _mm512_shuffle_f32x4(x[k__+8], x[k__+12], _MM_SHUFFLE(3,1,3,1));                    \
+    }                                                                                                   \
+    UNROLL_LOOP                                                                                         \
+    for (k__ = 0; k__ < 8; ++k__) {                                                                     \
+      x[k__] = _mm512_shuffle_f32x4(t__[k__], t__[k__+8], _MM_SHUFFLE(2,0,2,0));                        \
+      x[k__+8] = _mm512_shuffle_f32x4(t__[k__], t__[k__+8], _MM_SHUFFLE(3,1,3,1));                      \
+    }                                                                                                   \
+  }
+
+/* reverse/flip complex floats */
+#  define VREV_C(a)    _mm512_permutexvar_ps(_mm512_setr_epi32(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1), a)
+
+#  define VALIGNED(ptr) ((((uintptr_t)(ptr)) & 0x3F) == 0)
+
+#else
+/* #pragma message( __FILE__ ": AVX-512 float macros are not defined" ) */
+#endif
+
+#endif /* PF_AVX512_FLT_H */
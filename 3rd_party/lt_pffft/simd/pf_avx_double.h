@@ -60,12 +60,21 @@ typedef union v4sf_union {
   double f[SIMD_SZ];
 } v4sf_union;
 
-#  define VARCH "AVX"
+/* MSVC has no __FMA__, /arch:AVX2 implies FMA3 */
+#  if defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__))
+#    define VARCH "AVX+FMA"
+#    define VMADD(a,b,c) _mm256_fmadd_pd(a,b,c)
+#    define VCPLXMUL(ar,ai,br,bi) { v4sf tmp; tmp=_mm256_mul_pd(ar,bi); ar=_mm256_fmsub_pd(ar,br,_mm256_mul_pd(ai,bi)); ai=_mm256_fmadd_pd(ai,br,tmp); }
+#    define VCPLXMULCONJ(ar,ai,br,bi) { v4sf tmp; tmp=_mm256_mul_pd(ar,bi); ar=_mm256_fmadd_pd(ar,br,_mm256_mul_pd(ai,bi)); ai=_mm256_fmsub_pd(ai,br,tmp); }
+#  else
+#    define VARCH "AVX"
+#    define VMADD(a,b,c) _mm256_add_pd(_mm256_mul_pd(a,b), c)
+#  endif
+
 #  define VREQUIRES_ALIGN 1
 #  define VZERO() _mm256_setzero_pd()
 #  define VMUL(a,b) _mm256_mul_pd(a,b)
 #  define VADD(a,b) _mm256_add_pd(a,b)
-#  define VMADD(a,b,c) _mm256_add_pd(_mm256_mul_pd(a,b), c)
 #  define VSUB(a,b) _mm256_sub_pd(a,b)
 #  define LD_PS1(p) _mm256_set1_pd(p)
 #  define VLOAD_UNALIGNED(ptr)  _mm256_loadu_pd(ptr)
@@ -0,0 +1,128 @@
+
+/* Copyright (c) 2013  Julien Pommier ( pommier@modartt.com )
+
+   Redistribution and use of the Software in source and binary forms,
+   with or without modification, is permitted provided that the
+   following conditions are met:
+
+   - Neither the names of NCAR's Computational and Information Systems
+   Laboratory, the University Corporation for Atmospheric Research,
+   nor the names of its sponsors or contributors may be used to
+   endorse or promote products derived from this Software without
+   specific prior written permission.
+
+   - Redistributions of source code must retain the above copyright
+   notices, this list of conditions, and the disclaimer below.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions, and the disclaimer below in the
+   documentation and/or other materials provided with the
+   distribution.
+
+   THIS SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+   EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE CONTRIBUTORS OR COPYRIGHT
+   HOLDERS BE LIABLE FOR ANY CLAIM, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+   ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS WITH THE
+   SOFTWARE.
+*/
+
+#ifndef PF_AVX_FLT_H
+#define PF_AVX_FLT_H
+
+/*
+  AVX support macros for float, 8 floats per vector
+
+  With FMA the multiply-adds and complex multiplications use fused
+  instructions.
+*/
+#if !defined(SIMD_SZ) && !defined(PFFFT_SIMD_DISABLE) && defined(__AVX__)
+// #pragma message( __FILE__ ": AVX float macros are defined" )
+
+#include <immintrin.h>
+typedef __m256 v4sf;
+
+/* 8 floats by simd vector */
+#  define SIMD_SZ 8
+
+typedef union v4sf_union {
+  v4sf  v;
+  float f[SIMD_SZ];
+} v4sf_union;
+
+/* MSVC has no __FMA__, /arch:AVX2 implies FMA3 */
+#  if defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__))
+#    define VARCH "AVX+FMA"
+#    define VMADD(a,b,c) _mm256_fmadd_ps(a,b,c)
+#    define VCPLXMUL(ar,ai,br,bi) { v4sf tmp; tmp=_mm256_mul_ps(ar,bi); ar=_mm256_fmsub_ps(ar,br,_mm256_mul_ps(ai,bi)); ai=_mm256_fmadd_ps(ai,br,tmp); }
+#    define VCPLXMULCONJ(ar,ai,br,bi) { v4sf tmp; tmp=_mm256_mul_ps(ar,bi); ar=_mm256_fmadd_ps(ar,br,_mm256_mul_ps(ai,bi)); ai=_mm256_fmsub_ps(ai,br,tmp); }
+#  else
+#    define VARCH "AVX"
+#    define VMADD(a,b,c) _mm256_add_ps(_mm256_mul_ps(a,b), c)
+#  endif
+
+#  define VREQUIRES_ALIGN 1
+#  define VZERO() _mm256_setzero_ps()
+#  define VMUL(a,b) _mm256_mul_ps(a,b)
+#  define VADD(a,b) _mm256_add_ps(a,b)
+#  define VSUB(a,b) _mm256_sub_ps(a,b)
+#  define LD_PS1(p) _mm256_set1_ps(p)
+#  define VLOAD_UNALIGNED(ptr)  _mm256_loadu_ps(ptr)
+#  define VLOAD_ALIGNED(ptr)    _mm256_load_ps(ptr)
+#  define VSTORE_UNALIGNED(ptr, v)  _mm256_storeu_ps(ptr, v)
+
+/* INTERLEAVE2 (in1, in2, out1, out2) pseudo code:
+out1 = [ in1[0], in2[0], in1[1], in2[1], in1[2], in2[2], in1[3], in2[3] ]
+out2 = [ in1[4], in2[4], in1[5], in2[5], in1[6], in2[6], in1[7], in2[7] ]
+*/
+#  define INTERLEAVE2(in1, in2, out1, out2) {            \
+    __m256 lo__ = _mm256_unpacklo_ps(in1, in2);          \
+    __m256 hi__ = _mm256_unpackhi_ps(in1, in2);          \
+    out1 = _mm256_permute2f128_ps(lo__, hi__, 0x20);     \
+    out2 = _mm256_permute2f128_ps(lo__, hi__, 0x31);     \
+  }
+
+/* UNINTERLEAVE2 (in1, in2, out1, out2) pseudo code:
+out1 = [ in1[0], in1[2], in1[4], in1[6], in2[0], in2[2], in2[4], in2[6] ]
+out2 = [ in1[1], in1[3], in1[5], in1[7], in2[1], in2[3], in2[5], in2[7] ]
+*/
+#  define UNINTERLEAVE2(in1, in2, out1, out2) {                  \
+    __m256 lo__ = _mm256_permute2f128_ps(in1, in2, 0x20);        \
+    __m256 hi__ = _mm256_permute2f128_ps(in1, in2, 0x31);        \
+    out1 = _mm256_shuffle_ps(lo__, hi__, _MM_SHUFFLE(2,0,2,0));  \
+    out2 = _mm256_shuffle_ps(lo__, hi__, _MM_SHUFFLE(3,1,3,1));  \
+  }
+
+/* transposes the 8x8 matrix in the array x[8] of vectors */
+#  define VTRANSPOSE(x) {                                                                       \
+    __m256 t0__ = _mm256_unpacklo_ps(x[0], x[1]), t1__ = _mm256_unpackhi_ps(x[0], x[1]);       \
+    __m256 t2__ = _mm256_unpacklo_ps(x[2], x[3]), t3__ = _mm256_unpackhi_ps(x[2], x[3]);       \
+    __m256 t4__ = _mm256_unpacklo_ps(x[4], x[5]), t5__ = _mm256_unpackhi_ps(x[4], x[5]);       \
+    __m256 t6__ = _mm256_unpacklo_ps(x[6], x[7]), t7__ = _mm256_unpackhi_ps(x[6], x[7]);       \
+    __m256 u0__ = _mm256_shuffle_ps(t0__, t2__, _MM_SHUFFLE(1,0,1,0));                          \
+    __m256 u1__ = _mm256_shuffle_ps(t0__, t2__, _MM_SHUFFLE(3,2,3,2));                          \
+    __m256 u2__ = _mm256_shuffle_ps(t1__, t3__, _MM_SHUFFLE(1,0,1,0));                          \
+    __m256 u3__ = _mm256_shuffle_ps(t1__, t3__, _MM_SHUFFLE(3,2,3,2));                          \
+    __m256 u4__ = _mm256_shuffle_ps(t4__, t6__, _MM_SHUFFLE(1,0,1,0));                          \
+    __m256 u5__ = _mm256_shuffle_ps(t4__, t6__, _MM_SHUFFLE(3,2,3,2));                          \
+    __m256 u6__ = _mm256_shuffle_ps(t5__, t7__, _MM_SHUFFLE(1,0,1,0));                          \
+    __m256 u7__ = _mm256_shuffle_ps(t5__, t7__, _MM_SHUFFLE(3,2,3,2));                          \
+    x[0] = _mm256_permute2f128_ps(u0__, u4__, 0x20); x[4] = _mm256_permute2f128_ps(u0__, u4__, 0x31); \
+    x[1] = _mm256_permute2f128_ps(u1__, u5__, 0x20); x[5] = _mm256_permute2f128_ps(u1__, u5__, 0x31); \
+    x[2] = _mm256_permute2f128_ps(u2__, u6__, 0x20); x[6] = _mm256_permute2f128_ps(u2__, u6__, 0x31); \
+    x[3] = _mm256_permute2f128_ps(u3__, u7__, 0x20); x[7] = _mm256_permute2f128_ps(u3__, u7__, 0x31); \
+  }
+
+/* reverse/flip complex floats */
+#  define VREV_C(a)    _mm256_permute_ps(_mm256_permute2f128_ps(a, a, 0x01), _MM_SHUFFLE(1,0,3,2))
+
+#  define VALIGNED(ptr) ((((uintptr_t)(ptr)) & 0x1F) == 0)
+
+#else
+/* #pragma message( __FILE__ ": AVX float macros are not defined" ) */
+#endif
+
+#endif /* PF_AVX_FLT_H */
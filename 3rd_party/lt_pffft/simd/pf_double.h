@@ -59,6 +59,7 @@
 
 typedef double vsfscalar;
 
+#include "pf_avx512_double.h"
 #include "pf_avx_double.h"
 #include "pf_sse2_double.h"
 #include "pf_neon_double.h"
@@ -73,8 +74,10 @@ typedef double vsfscalar;
 #include "pf_scalar_double.h"
 
 /* shortcuts for complex multiplcations */
+#ifndef VCPLXMUL
 #define VCPLXMUL(ar,ai,br,bi) { v4sf tmp; tmp=VMUL(ar,bi); ar=VMUL(ar,br); ar=VSUB(ar,VMUL(ai,bi)); ai=VMUL(ai,br); ai=VADD(ai,tmp); }
 #define VCPLXMULCONJ(ar,ai,br,bi) { v4sf tmp; tmp=VMUL(ar,bi); ar=VMUL(ar,br); ar=VADD(ar,VMUL(ai,bi)); ai=VMUL(ai,br); ai=VSUB(ai,tmp); }
+#endif
 #ifndef SVMUL
 /* multiply a scalar with a vector */
 #define SVMUL(f,v) VMUL(LD_PS1(f),v)
@@ -59,6 +59,8 @@
 
 typedef float vsfscalar;
 
+#include "pf_avx512_float.h"
+#include "pf_avx_float.h"
 #include "pf_sse1_float.h"
 #include "pf_neon_float.h"
 #include "pf_altivec_float.h"
@@ -73,8 +75,10 @@ typedef float vsfscalar;
 #include "pf_scalar_float.h"
 
 /* shortcuts for complex multiplcations */
+#ifndef VCPLXMUL
 #define VCPLXMUL(ar,ai,br,bi) { v4sf tmp; tmp=VMUL(ar,bi); ar=VMUL(ar,br); ar=VSUB(ar,VMUL(ai,bi)); ai=VMUL(ai,br); ai=VADD(ai,tmp); }
 #define VCPLXMULCONJ(ar,ai,br,bi) { v4sf tmp; tmp=VMUL(ar,bi); ar=VMUL(ar,br); ar=VADD(ar,VMUL(ai,bi)); ai=VMUL(ai,br); ai=VSUB(ai,tmp); }
+#endif
 #ifndef SVMUL
 /* multiply a scalar with a vector */
 #define SVMUL(f,v) VMUL(LD_PS1(f),v)
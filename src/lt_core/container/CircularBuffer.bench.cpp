@@ -0,0 +1,176 @@
+#include "lt_core/lt_core.hpp"
+
+#include <benchmark/benchmark.h>
+
+static constexpr auto benchmarkBufferSize  = 4096U;
+static constexpr auto benchmarkHistorySize = 32U;
+
+static void lt_CircularBuffer_PushBack(benchmark::State& state)
+{
+    auto const blockSize = static_cast<std::size_t>(state.range(0));
+    auto buffer          = lt::CircularBuffer<float>{benchmarkBufferSize};
+    auto input           = std::vector<float>(blockSize, 1.0F);
+
+    for (auto _ : state)
+    {
+        std::copy(std::cbegin(input), std::cend(input), std::back_inserter(buffer));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(lt_CircularBuffer_PushBack)->Arg(64)->Arg(512)->Arg(4096);
+
+static void lt_CircularBuffer_Write(benchmark::State& state)
+{
+    auto const blockSize = static_cast<std::size_t>(state.range(0));
+    auto buffer          = lt::CircularBuffer<float>{benchmarkBufferSize};
+    auto input           = std::vector<float>(blockSize, 1.0F);
+
+    for (auto _ : state)
+    {
+        buffer.write(lt::Span<float const>{input});
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(lt_CircularBuffer_Write)->Arg(64)->Arg(512)->Arg(4096);
+
+static void lt_CircularBuffer_IteratorCopy(benchmark::State& state)
+{
+    auto const blockSize = static_cast<std::uint32_t>(state.range(0));
+    auto buffer          = lt::CircularBuffer<float>{blockSize};
+    auto output          = std::vector<float>(blockSize);
+
+    // Move the write index away from zero, so the copy wraps around.
+    buffer.push_back(1.0F);
+
+    for (auto _ : state)
+    {
+        std::copy(std::cbegin(buffer), std::cend(buffer), std::begin(output));
+        benchmark::DoNotOptimize(output.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(lt_CircularBuffer_IteratorCopy)->Arg(64)->Arg(512)->Arg(4096);
+
+static void lt_CircularBuffer_CopyTo(benchmark::State& state)
+{
+    auto const blockSize = static_cast<std::uint32_t>(state.range(0));
+    auto buffer          = lt::CircularBuffer<float>{blockSize};
+    auto output          = std::vector<float>(blockSize);
+
+    // Move the write index away from zero, so the copy wraps around.
+    buffer.push_back(1.0F);
+
+    for (auto _ : state)
+    {
+        buffer.copyTo(lt::Span<float>{output});
+        benchmark::DoNotOptimize(output.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(lt_CircularBuffer_CopyTo)->Arg(64)->Arg(512)->Arg(4096);
+
+template<typename BufferType>
+static void lt_CircularBuffer_IndexedSum(benchmark::State& state)
+{
+    auto const size = static_cast<std::uint32_t>(state.range(0));
+    auto buffer     = BufferType{size};
+
+    // Move the write index away from zero, so the access wraps around.
+    buffer.push_back(1.0F);
+
+    for (auto _ : state)
+    {
+        auto sum = 0.0F;
+        for (auto i{0U}; i < size; ++i) { sum += buffer[i]; }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(lt_CircularBuffer_IndexedSum, lt::CircularBuffer<float>)->Arg(64)->Arg(512)->Arg(4096);
+BENCHMARK_TEMPLATE(lt_CircularBuffer_IndexedSum, lt::PowerOfTwoCircularBuffer<float>)->Arg(64)->Arg(512)->Arg(4096);
+
+static void lt_CircularBuffer_IteratorTransform(benchmark::State& state)
+{
+    auto const size = static_cast<std::uint32_t>(state.range(0));
+    auto buffer     = lt::CircularBuffer<float>{size};
+    auto output     = std::vector<float>(size);
+
+    // Move the write index away from zero, so the range wraps around.
+    buffer.push_back(1.0F);
+
+    for (auto _ : state)
+    {
+        std::transform(std::cbegin(buffer), std::cend(buffer), std::begin(output), [](auto x) { return x * 0.5F; });
+        benchmark::DoNotOptimize(output.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(lt_CircularBuffer_IteratorTransform)->Arg(64)->Arg(512)->Arg(4096);
+
+static void lt_CircularBuffer_SegmentTransform(benchmark::State& state)
+{
+    auto const size = static_cast<std::uint32_t>(state.range(0));
+    auto buffer     = lt::CircularBuffer<float>{size};
+    auto output     = std::vector<float>(size);
+
+    // Move the write index away from zero, so the range wraps around.
+    buffer.push_back(1.0F);
+
+    for (auto _ : state)
+    {
+        lt::transformSegments(std::as_const(buffer).segments(), std::begin(output), [](auto x) { return x * 0.5F; });
+        benchmark::DoNotOptimize(output.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(lt_CircularBuffer_SegmentTransform)->Arg(64)->Arg(512)->Arg(4096);
+
+// A bank of short histories, as in an array of filters. Each sample is
+// pushed into every history, which is then summed.
+template<typename BufferType>
+static auto makeFilterBank(std::size_t size) -> std::vector<BufferType>
+{
+    if constexpr (std::is_constructible_v<BufferType, std::uint32_t>)
+    {
+        return std::vector<BufferType>(size, BufferType{benchmarkHistorySize});
+    }
+    else { return std::vector<BufferType>(size); }
+}
+
+template<typename BufferType>
+static void lt_CircularBuffer_FilterBank(benchmark::State& state)
+{
+    auto bank = makeFilterBank<BufferType>(static_cast<std::size_t>(state.range(0)));
+
+    auto sample = 0.0F;
+    for (auto _ : state)
+    {
+        auto sum = 0.0F;
+        for (auto& history : bank)
+        {
+            history.push_back(sample);
+            for (auto i{0U}; i < benchmarkHistorySize; ++i) { sum += history[i]; }
+        }
+        sample += 1.0F;
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(lt_CircularBuffer_FilterBank, lt::PowerOfTwoCircularBuffer<float>)->Arg(16)->Arg(256);
+BENCHMARK_TEMPLATE(lt_CircularBuffer_FilterBank, lt::StaticCircularBuffer<float, benchmarkHistorySize>)
+    ->Arg(16)
+    ->Arg(256);
\ No newline at end of file
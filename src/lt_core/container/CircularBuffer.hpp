@@ -3,8 +3,50 @@
 namespace lt
 {
 
-template<typename T>
-struct CircularBuffer
+/// \brief CircularBuffer index policy for any size, wraps with a compare.
+struct WrappedIndex
+{
+    [[nodiscard]] static constexpr auto isValidSize(std::uint32_t /*size*/) noexcept -> bool { return true; }
+
+    /// \brief Maps index in [0, 2 * size) to [0, size).
+    [[nodiscard]] static constexpr auto wrap(std::uint32_t index, std::uint32_t size) noexcept -> std::uint32_t
+    {
+        return index >= size ? index - size : index;
+    }
+};
+
+/// \brief CircularBuffer index policy for power of two sizes, wraps with a
+/// bitmask, which keeps element access free of branches.
+struct MaskedIndex
+{
+    [[nodiscard]] static constexpr auto isValidSize(std::uint32_t size) noexcept -> bool
+    {
+        return (size & (size - 1U)) == 0U;
+    }
+
+    /// \brief Maps any index to [0, size).
+    [[nodiscard]] static constexpr auto wrap(std::uint32_t index, std::uint32_t size) noexcept -> std::uint32_t
+    {
+        return index & (size - 1U);
+    }
+};
+
+/// \brief What CircularBuffer::resize() does with the current elements.
+enum struct ResizeMode
+{
+    keepNewest,
+    clear,
+};
+
+/// \brief Element access and bulk copies shared by CircularBuffer and
+/// StaticCircularBuffer.
+///
+/// \details Buffer derives from this base, stores its elements in a
+/// contiguous _buffer and provides size(). The base only keeps the write
+/// index, so the storage decides whether the size is fixed at compile
+/// time or can change.
+template<typename Buffer, typename T, typename IndexPolicy>
+struct CircularBufferBase
 {
     using value_type             = T;
     using reference              = value_type&;
@@ -12,17 +54,12 @@ struct CircularBuffer
     using pointer                = value_type*;
     using const_pointer          = value_type const*;
     using size_type              = std::uint32_t;
-    using iterator               = IndexIterator<CircularBuffer<T>, false>;
-    using const_iterator         = IndexIterator<CircularBuffer<T>, true>;
+    using index_policy           = IndexPolicy;
+    using iterator               = IndexIterator<Buffer, false>;
+    using const_iterator         = IndexIterator<Buffer, true>;
     using reverse_iterator       = std::reverse_iterator<iterator>;
     using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
-    CircularBuffer() = default;
-    explicit CircularBuffer(size_type size, value_type val = {});
-
-    [[nodiscard]] auto empty() const noexcept -> bool;
-    [[nodiscard]] auto size() const noexcept -> size_type;
-
     [[nodiscard]] auto begin() -> iterator;
     [[nodiscard]] auto begin() const -> const_iterator;
     [[nodiscard]] auto cbegin() const -> const_iterator;
@@ -34,103 +71,297 @@ struct CircularBuffer
     [[nodiscard]] auto operator[](size_type index) -> reference;
     [[nodiscard]] auto operator[](size_type index) const -> const_reference;
 
+    /// \brief The whole buffer, oldest element first.
+    [[nodiscard]] auto segments() noexcept -> RingSegments<value_type>;
+    [[nodiscard]] auto segments() const noexcept -> RingSegments<value_type const>;
+
+    /// \brief count elements starting at the given index.
+    [[nodiscard]] auto segments(size_type index, size_type count) noexcept -> RingSegments<value_type>;
+    [[nodiscard]] auto segments(size_type index, size_type count) const noexcept -> RingSegments<value_type const>;
+
     auto push_back(const_reference val) -> void;
-    auto resize(size_type newSize) -> void;
+
+    /// \brief Appends all values, same as calling push_back for each one.
+    auto write(Span<value_type const> values) -> void;
+
+    /// \brief Copies the oldest values and shifts in value initialized elements.
+    auto read(Span<value_type> values) -> void;
+
+    /// \brief Copies values starting at the given index, without modifying the buffer.
+    auto peek(Span<value_type> values, size_type offset = 0) const -> void;
+
+    /// \brief Copies all elements from oldest to newest, values must hold size() elements.
+    auto copyTo(Span<value_type> values) const -> void;
+
+protected:
+    size_type _writeIndex{0};
+
+private:
+    [[nodiscard]] auto self() noexcept -> Buffer& { return static_cast<Buffer&>(*this); }
+    [[nodiscard]] auto self() const noexcept -> Buffer const& { return static_cast<Buffer const&>(*this); }
+
+    template<typename Self>
+    [[nodiscard]] static auto segmentsOf(Self& self, size_type index, size_type count) noexcept;
+};
+
+/// \brief Fixed size window over the most recently written elements.
+///
+/// \details The buffer always holds size() elements, index 0 is the
+/// oldest one. Writing pushes out the oldest elements. The bulk
+/// functions copy in at most two contiguous segments, which compile to
+/// memcpy for trivially copyable types. segments() exposes the same
+/// split for use with the algorithms in RingSegments.hpp.
+///
+/// The IndexPolicy maps positions to storage indices. MaskedIndex
+/// requires a power of two size and replaces the compare and subtract
+/// in every access with a bitmask.
+///
+/// resize() never allocates as long as the new size fits the capacity
+/// set up front with reserve(), so the window length can be changed
+/// from the audio thread.
+template<typename T, typename IndexPolicy = WrappedIndex>
+struct CircularBuffer : CircularBufferBase<CircularBuffer<T, IndexPolicy>, T, IndexPolicy>
+{
+    using base_type = CircularBufferBase<CircularBuffer, T, IndexPolicy>;
+    using typename base_type::size_type;
+    using typename base_type::value_type;
+
+    CircularBuffer() = default;
+    explicit CircularBuffer(size_type size, value_type val = {});
+
+    [[nodiscard]] auto empty() const noexcept -> bool;
+    [[nodiscard]] auto size() const noexcept -> size_type;
+    [[nodiscard]] auto capacity() const noexcept -> size_type;
+
+    /// \brief Allocates storage for up to newCapacity elements.
+    auto reserve(size_type newCapacity) -> void;
+
+    /// \brief Changes the window length, only allocates past capacity().
+    ///
+    /// \details keepNewest keeps the most recent elements in order, new
+    /// elements are value initialized and become the oldest ones. clear
+    /// value initializes every element.
+    auto resize(size_type newSize, ResizeMode mode = ResizeMode::keepNewest) -> void;
     auto clear() -> void;
 
 private:
+    friend base_type;
+
     std::vector<value_type> _buffer{};
-    size_type _writeIndex{0};
 };
 
+/// \brief CircularBuffer with power of two size and masked indexing.
 template<typename T>
-CircularBuffer<T>::CircularBuffer(size_type size, value_type val) : _buffer(size, val)
+using PowerOfTwoCircularBuffer = CircularBuffer<T, MaskedIndex>;
+
+template<typename Buffer, typename T, typename IndexPolicy>
+auto CircularBufferBase<Buffer, T, IndexPolicy>::begin() -> iterator
 {
-    jassert(std::size(_buffer) == size);
+    return iterator{&self(), 0};
+}
+template<typename Buffer, typename T, typename IndexPolicy>
+auto CircularBufferBase<Buffer, T, IndexPolicy>::end() -> iterator
+{
+    return iterator{&self(), self().size()};
 }
 
-template<typename T>
-auto CircularBuffer<T>::empty() const noexcept -> bool
+template<typename Buffer, typename T, typename IndexPolicy>
+auto CircularBufferBase<Buffer, T, IndexPolicy>::begin() const -> const_iterator
 {
-    return std::empty(_buffer);
+    return const_iterator{&self(), 0};
+}
+template<typename Buffer, typename T, typename IndexPolicy>
+auto CircularBufferBase<Buffer, T, IndexPolicy>::end() const -> const_iterator
+{
+    return const_iterator{&self(), self().size()};
 }
 
-template<typename T>
-auto CircularBuffer<T>::size() const noexcept -> size_type
+template<typename Buffer, typename T, typename IndexPolicy>
+auto CircularBufferBase<Buffer, T, IndexPolicy>::cbegin() const -> const_iterator
 {
-    return narrowCast<size_type>(std::size(_buffer));
+    return const_iterator{&self(), 0};
+}
+template<typename Buffer, typename T, typename IndexPolicy>
+auto CircularBufferBase<Buffer, T, IndexPolicy>::cend() const -> const_iterator
+{
+    return const_iterator{&self(), self().size()};
 }
 
-template<typename T>
-auto CircularBuffer<T>::begin() -> iterator
+template<typename Buffer, typename T, typename IndexPolicy>
+auto CircularBufferBase<Buffer, T, IndexPolicy>::push_back(const_reference val) -> void
 {
-    return iterator{this, 0};
+    auto const size = self().size();
+    jassert(size != 0U);
+    self()._buffer[_writeIndex] = val;
+    _writeIndex                 = IndexPolicy::wrap(_writeIndex + 1U, size);
 }
-template<typename T>
-auto CircularBuffer<T>::end() -> iterator
+
+template<typename Buffer, typename T, typename IndexPolicy>
+auto CircularBufferBase<Buffer, T, IndexPolicy>::write(Span<value_type const> values) -> void
 {
-    return iterator{this, size()};
+    auto const size = self().size();
+    jassert(size != 0U);
+
+    // Only the last size() values survive.
+    if (std::size(values) > size) { values = values.last(size); }
+
+    // The oldest elements are the ones to overwrite.
+    auto const count = narrowCast<size_type>(std::size(values));
+    copySegments(std::begin(values), segments(0, count));
+    _writeIndex = IndexPolicy::wrap(_writeIndex + count, size);
 }
 
-template<typename T>
-auto CircularBuffer<T>::begin() const -> const_iterator
+template<typename Buffer, typename T, typename IndexPolicy>
+auto CircularBufferBase<Buffer, T, IndexPolicy>::read(Span<value_type> values) -> void
 {
-    return const_iterator{this, 0};
+    jassert(std::size(values) <= self().size());
+
+    peek(values);
+
+    // The oldest elements become the newest ones.
+    auto const count = narrowCast<size_type>(std::size(values));
+    forEachSegment(segments(0, count), [](auto span, auto) { std::fill(std::begin(span), std::end(span), value_type{}); });
+    _writeIndex = IndexPolicy::wrap(_writeIndex + count, self().size());
 }
-template<typename T>
-auto CircularBuffer<T>::end() const -> const_iterator
+
+template<typename Buffer, typename T, typename IndexPolicy>
+auto CircularBufferBase<Buffer, T, IndexPolicy>::peek(Span<value_type> values, size_type offset) const -> void
 {
-    return const_iterator{this, size()};
+    copySegments(segments(offset, narrowCast<size_type>(std::size(values))), std::begin(values));
 }
 
-template<typename T>
-auto CircularBuffer<T>::cbegin() const -> const_iterator
+template<typename Buffer, typename T, typename IndexPolicy>
+auto CircularBufferBase<Buffer, T, IndexPolicy>::segments() noexcept -> RingSegments<value_type>
 {
-    return const_iterator{this, 0};
+    return segmentsOf(self(), 0, self().size());
 }
-template<typename T>
-auto CircularBuffer<T>::cend() const -> const_iterator
+
+template<typename Buffer, typename T, typename IndexPolicy>
+auto CircularBufferBase<Buffer, T, IndexPolicy>::segments() const noexcept -> RingSegments<value_type const>
 {
-    return const_iterator{this, size()};
+    return segmentsOf(self(), 0, self().size());
 }
 
-template<typename T>
-auto CircularBuffer<T>::push_back(const_reference val) -> void
+template<typename Buffer, typename T, typename IndexPolicy>
+auto CircularBufferBase<Buffer, T, IndexPolicy>::segments(size_type index, size_type count) noexcept
+    -> RingSegments<value_type>
 {
-    jassert(size() != 0U);
-    _buffer[_writeIndex] = val;
-    if (_writeIndex++; _writeIndex >= size()) { _writeIndex = 0; }
+    return segmentsOf(self(), index, count);
 }
 
-template<typename T>
-auto CircularBuffer<T>::operator[](size_type index) -> reference
+template<typename Buffer, typename T, typename IndexPolicy>
+auto CircularBufferBase<Buffer, T, IndexPolicy>::segments(size_type index, size_type count) const noexcept
+    -> RingSegments<value_type const>
 {
-    jassert(index < size());
-    auto const i = _writeIndex + index;
-    if (i >= size()) { return _buffer[i - size()]; }
-    return _buffer[i];
+    return segmentsOf(self(), index, count);
 }
 
-template<typename T>
-auto CircularBuffer<T>::operator[](size_type index) const -> const_reference
+template<typename Buffer, typename T, typename IndexPolicy>
+template<typename Self>
+auto CircularBufferBase<Buffer, T, IndexPolicy>::segmentsOf(Self& self, size_type index, size_type count) noexcept
 {
-    jassert(index < size());
-    auto const i = _writeIndex + index;
-    if (i >= size()) { return _buffer[i - size()]; }
-    return _buffer[i];
+    jassert(index + count <= self.size());
+
+    using Value = std::remove_pointer_t<decltype(self._buffer.data())>;
+    if (count == 0U) { return RingSegments<Value>{}; }
+
+    auto* const data = self._buffer.data();
+    auto const start = IndexPolicy::wrap(self._writeIndex + index, self.size());
+    auto const first = std::min(count, self.size() - start);
+    return RingSegments<Value>{Span<Value>{std::next(data, start), first}, Span<Value>{data, count - first}};
 }
 
-template<typename T>
-auto CircularBuffer<T>::resize(size_type newSize) -> void
+template<typename Buffer, typename T, typename IndexPolicy>
+auto CircularBufferBase<Buffer, T, IndexPolicy>::copyTo(Span<value_type> values) const -> void
 {
-    _buffer.resize(newSize);
+    jassert(std::size(values) == self().size());
+    peek(values);
 }
 
-template<typename T>
-auto CircularBuffer<T>::clear() -> void
+template<typename Buffer, typename T, typename IndexPolicy>
+auto CircularBufferBase<Buffer, T, IndexPolicy>::operator[](size_type index) -> reference
+{
+    jassert(index < self().size());
+    return self()._buffer[IndexPolicy::wrap(_writeIndex + index, self().size())];
+}
+
+template<typename Buffer, typename T, typename IndexPolicy>
+auto CircularBufferBase<Buffer, T, IndexPolicy>::operator[](size_type index) const -> const_reference
+{
+    jassert(index < self().size());
+    return self()._buffer[IndexPolicy::wrap(_writeIndex + index, self().size())];
+}
+
+template<typename T, typename IndexPolicy>
+CircularBuffer<T, IndexPolicy>::CircularBuffer(size_type size, value_type val) : _buffer(size, val)
+{
+    jassert(std::size(_buffer) == size);
+    jassert(IndexPolicy::isValidSize(size));
+}
+
+template<typename T, typename IndexPolicy>
+auto CircularBuffer<T, IndexPolicy>::empty() const noexcept -> bool
+{
+    return std::empty(_buffer);
+}
+
+template<typename T, typename IndexPolicy>
+auto CircularBuffer<T, IndexPolicy>::size() const noexcept -> size_type
+{
+    return narrowCast<size_type>(std::size(_buffer));
+}
+
+template<typename T, typename IndexPolicy>
+auto CircularBuffer<T, IndexPolicy>::capacity() const noexcept -> size_type
+{
+    return narrowCast<size_type>(_buffer.capacity());
+}
+
+template<typename T, typename IndexPolicy>
+auto CircularBuffer<T, IndexPolicy>::reserve(size_type newCapacity) -> void
+{
+    _buffer.reserve(newCapacity);
+}
+
+template<typename T, typename IndexPolicy>
+auto CircularBuffer<T, IndexPolicy>::resize(size_type newSize, ResizeMode mode) -> void
+{
+    jassert(IndexPolicy::isValidSize(newSize));
+
+    if (mode == ResizeMode::clear)
+    {
+        _buffer.resize(newSize);
+        std::fill(std::begin(_buffer), std::end(_buffer), value_type{});
+        this->_writeIndex = 0;
+        return;
+    }
+
+    // Move the oldest element to the front, the storage then is in
+    // logical order and the write index is zero.
+    auto const first   = std::begin(_buffer);
+    auto const oldSize = size();
+    std::rotate(first, std::next(first, this->_writeIndex), std::end(_buffer));
+    this->_writeIndex = 0;
+
+    if (newSize < oldSize)
+    {
+        // Drop the oldest elements.
+        std::move(std::next(first, oldSize - newSize), std::end(_buffer), first);
+        _buffer.resize(newSize);
+    }
+    else
+    {
+        // Appended elements rotate to the front, they are the oldest.
+        _buffer.resize(newSize);
+        std::rotate(std::begin(_buffer), std::next(std::begin(_buffer), oldSize), std::end(_buffer));
+    }
+}
+
+template<typename T, typename IndexPolicy>
+auto CircularBuffer<T, IndexPolicy>::clear() -> void
 {
     _buffer.clear();
-    _writeIndex = 0;
+    this->_writeIndex = 0;
 }
 
 }  // namespace lt
\ No newline at end of file
@@ -54,4 +54,199 @@ TEMPLATE_TEST_CASE("core/container: CircularBuffer", "[core][container]", short,
         REQUIRE(*(cf++) == T{5});
         REQUIRE(cf == cl);
     }
+
+    SECTION("write")
+    {
+        auto cb = lt::CircularBuffer<T>{4U, T{}};
+
+        auto const first = std::vector<T>{1, 2, 3};
+        cb.write(lt::Span<T const>{first});
+        REQUIRE(cb[0] == T{0});
+        REQUIRE(cb[1] == T{1});
+        REQUIRE(cb[2] == T{2});
+        REQUIRE(cb[3] == T{3});
+
+        // Wraps around the end of the storage.
+        auto const second = std::vector<T>{4, 5, 6};
+        cb.write(lt::Span<T const>{second});
+        REQUIRE(cb[0] == T{3});
+        REQUIRE(cb[1] == T{4});
+        REQUIRE(cb[2] == T{5});
+        REQUIRE(cb[3] == T{6});
+
+        // Longer than the buffer, only the last values are kept.
+        auto const third = std::vector<T>{7, 8, 9, 10, 11, 12};
+        cb.write(lt::Span<T const>{third});
+        REQUIRE(cb[0] == T{9});
+        REQUIRE(cb[1] == T{10});
+        REQUIRE(cb[2] == T{11});
+        REQUIRE(cb[3] == T{12});
+    }
+
+    SECTION("write matches push_back")
+    {
+        auto bulk   = lt::CircularBuffer<T>{7U, T{}};
+        auto single = lt::CircularBuffer<T>{7U, T{}};
+
+        auto values = std::vector<T>{};
+        for (auto i{0}; i < 50; ++i) { values.push_back(static_cast<T>(i)); }
+
+        for (auto size : {1U, 3U, 5U, 7U, 2U, 9U, 4U})
+        {
+            auto const chunk = lt::Span<T const>{values}.first(size);
+            bulk.write(chunk);
+            for (auto v : chunk) { single.push_back(v); }
+            REQUIRE(std::equal(std::cbegin(bulk), std::cend(bulk), std::cbegin(single), std::cend(single)));
+        }
+    }
+
+    SECTION("peek & copyTo")
+    {
+        auto cb = lt::CircularBuffer<T>{5U, T{}};
+        for (auto i{1}; i <= 7; ++i) { cb.push_back(static_cast<T>(i)); }
+
+        auto all = std::vector<T>(5U);
+        cb.copyTo(lt::Span<T>{all});
+        REQUIRE(all == std::vector<T>{3, 4, 5, 6, 7});
+
+        auto part = std::vector<T>(3U);
+        cb.peek(lt::Span<T>{part}, 1U);
+        REQUIRE(part == std::vector<T>{4, 5, 6});
+
+        cb.peek(lt::Span<T>{part}, 2U);
+        REQUIRE(part == std::vector<T>{5, 6, 7});
+        REQUIRE(cb[0] == T{3});
+    }
+
+    SECTION("segments")
+    {
+        auto cb = lt::CircularBuffer<T>{5U, T{}};
+        for (auto i{1}; i <= 7; ++i) { cb.push_back(static_cast<T>(i)); }
+
+        // Storage is {6, 7, 3, 4, 5}, the oldest element is at index 2.
+        auto const all = cb.segments();
+        REQUIRE(all.size() == 5U);
+        REQUIRE(std::vector<T>(std::begin(all.first), std::end(all.first)) == std::vector<T>{3, 4, 5});
+        REQUIRE(std::vector<T>(std::begin(all.second), std::end(all.second)) == std::vector<T>{6, 7});
+
+        auto const head = std::as_const(cb).segments(0U, 2U);
+        REQUIRE(std::size(head.first) == 2U);
+        REQUIRE(std::empty(head.second));
+        REQUIRE(head.first[1] == T{4});
+
+        auto const tail = cb.segments(3U, 2U);
+        REQUIRE(std::empty(tail.second));
+        REQUIRE(tail.first[0] == T{6});
+
+        REQUIRE(cb.segments(1U, 0U).empty());
+
+        for (auto index{0U}; index < cb.size(); ++index)
+        {
+            for (auto count{0U}; index + count <= cb.size(); ++count)
+            {
+                auto out = std::vector<T>{};
+                lt::copySegments(cb.segments(index, count), std::back_inserter(out));
+                REQUIRE(std::equal(std::cbegin(out), std::cend(out), std::next(std::cbegin(cb), index)));
+            }
+        }
+    }
+
+    SECTION("reserve & resize")
+    {
+        auto cb = lt::CircularBuffer<T>{4U, T{}};
+        cb.reserve(16U);
+        REQUIRE(cb.capacity() >= 16U);
+        REQUIRE(cb.size() == 4U);
+
+        // Leaves the write index in the middle of the storage.
+        for (auto i{1}; i <= 6; ++i) { cb.push_back(static_cast<T>(i)); }
+        auto const* storage = &cb[0] - 2;
+
+        cb.resize(6U);
+        REQUIRE(cb.size() == 6U);
+        REQUIRE(std::vector<T>(std::cbegin(cb), std::cend(cb)) == std::vector<T>{0, 0, 3, 4, 5, 6});
+
+        cb.resize(3U);
+        REQUIRE(std::vector<T>(std::cbegin(cb), std::cend(cb)) == std::vector<T>{4, 5, 6});
+
+        // The write index is still valid after shrinking.
+        cb.push_back(T{7});
+        REQUIRE(std::vector<T>(std::cbegin(cb), std::cend(cb)) == std::vector<T>{5, 6, 7});
+
+        cb.resize(16U, lt::ResizeMode::clear);
+        REQUIRE(cb.size() == 16U);
+        REQUIRE(std::all_of(std::cbegin(cb), std::cend(cb), [](auto v) { return v == T{}; }));
+        cb.push_back(T{8});
+        REQUIRE(cb[15] == T{8});
+
+        // Nothing was reallocated.
+        REQUIRE(&cb[0] - 1 == storage);
+    }
+
+    SECTION("read")
+    {
+        auto cb = lt::CircularBuffer<T>{4U, T{}};
+        for (auto i{1}; i <= 6; ++i) { cb.push_back(static_cast<T>(i)); }
+
+        auto out = std::vector<T>(3U);
+        cb.read(lt::Span<T>{out});
+        REQUIRE(out == std::vector<T>{3, 4, 5});
+        REQUIRE(cb.size() == 4U);
+        REQUIRE(cb[0] == T{6});
+        REQUIRE(cb[1] == T{0});
+        REQUIRE(cb[2] == T{0});
+        REQUIRE(cb[3] == T{0});
+
+        cb.push_back(T{7});
+        REQUIRE(cb[0] == T{0});
+        REQUIRE(cb[3] == T{7});
+    }
+}
+
+TEMPLATE_TEST_CASE("core/container: PowerOfTwoCircularBuffer", "[core][container]", int, float, double)
+{
+    using T = TestType;
+
+    REQUIRE(lt::MaskedIndex::isValidSize(0U));
+    REQUIRE(lt::MaskedIndex::isValidSize(1U));
+    REQUIRE(lt::MaskedIndex::isValidSize(1024U));
+    REQUIRE_FALSE(lt::MaskedIndex::isValidSize(3U));
+    REQUIRE_FALSE(lt::MaskedIndex::isValidSize(1000U));
+
+    REQUIRE(lt::MaskedIndex::wrap(7U, 8U) == 7U);
+    REQUIRE(lt::MaskedIndex::wrap(8U, 8U) == 0U);
+    REQUIRE(lt::MaskedIndex::wrap(13U, 8U) == 5U);
+
+    auto const size = GENERATE(1U, 2U, 8U, 64U);
+
+    auto masked  = lt::PowerOfTwoCircularBuffer<T>{size, T{}};
+    auto wrapped = lt::CircularBuffer<T>{size, T{}};
+
+    auto values = std::vector<T>{};
+    for (auto i{0}; i < 200; ++i) { values.push_back(static_cast<T>(i)); }
+
+    auto const matches = [&] {
+        for (auto i{0U}; i < size; ++i) { REQUIRE(masked[i] == wrapped[i]); }
+        return std::equal(std::cbegin(masked), std::cend(masked), std::cbegin(wrapped), std::cend(wrapped));
+    };
+
+    for (auto chunk : {1U, 3U, 5U, 13U, 2U, 70U, 7U})
+    {
+        auto const input = lt::Span<T const>{values}.first(chunk);
+        masked.write(input);
+        wrapped.write(input);
+        REQUIRE(matches());
+
+        masked.push_back(T{-1});
+        wrapped.push_back(T{-1});
+        REQUIRE(matches());
+
+        auto const count = std::min(chunk, size);
+        auto fromMasked  = std::vector<T>(count);
+        auto fromWrapped = std::vector<T>(count);
+        masked.read(lt::Span<T>{fromMasked});
+        wrapped.read(lt::Span<T>{fromWrapped});
+        REQUIRE(fromMasked == fromWrapped);
+        REQUIRE(matches());
+    }
 }
\ No newline at end of file
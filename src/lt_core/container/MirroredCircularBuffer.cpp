@@ -0,0 +1,101 @@
+#if JUCE_LINUX
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace lt::detail
+{
+
+MirroredMapping::MirroredMapping(std::size_t minBytes)
+{
+    auto const page  = granularity();
+    auto const bytes = (minBytes + page - 1U) / page * page;
+    if (bytes == 0U) { return; }
+
+#if JUCE_LINUX
+    // Reserve both halves first, then map the same memory file over each.
+    if (auto const fd = ::memfd_create("lt_mirrored", MFD_CLOEXEC); fd != -1)
+    {
+        auto* const base = ::mmap(nullptr, bytes * 2U, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base != MAP_FAILED)
+        {
+            auto* const lower = static_cast<char*>(base);
+            auto* const upper = std::next(lower, signCast<std::ptrdiff_t>(bytes));
+            auto const flags  = MAP_SHARED | MAP_FIXED;
+            auto const prot   = PROT_READ | PROT_WRITE;
+
+            if (::ftruncate(fd, signCast<off_t>(bytes)) == 0 && ::mmap(lower, bytes, prot, flags, fd, 0) == lower
+                && ::mmap(upper, bytes, prot, flags, fd, 0) == upper)
+            {
+                _data     = base;
+                _size     = bytes;
+                _mirrored = true;
+            }
+            else
+            {
+                ::munmap(base, bytes * 2U);
+            }
+        }
+        ::close(fd);
+        if (_mirrored) { return; }
+    }
+#endif
+
+    _data = ::operator new(bytes * 2U, std::align_val_t{64});
+    _size = bytes;
+}
+
+MirroredMapping::~MirroredMapping() { release(); }
+
+MirroredMapping::MirroredMapping(MirroredMapping&& other) noexcept
+    : _data{std::exchange(other._data, nullptr)}
+    , _size{std::exchange(other._size, 0U)}
+    , _mirrored{std::exchange(other._mirrored, false)}
+{
+}
+
+auto MirroredMapping::operator=(MirroredMapping&& other) noexcept -> MirroredMapping&
+{
+    if (this != &other)
+    {
+        release();
+        _data     = std::exchange(other._data, nullptr);
+        _size     = std::exchange(other._size, 0U);
+        _mirrored = std::exchange(other._mirrored, false);
+    }
+    return *this;
+}
+
+auto MirroredMapping::data() const noexcept -> void* { return _data; }
+
+auto MirroredMapping::size() const noexcept -> std::size_t { return _size; }
+
+auto MirroredMapping::mirrored() const noexcept -> bool { return _mirrored; }
+
+auto MirroredMapping::granularity() noexcept -> std::size_t
+{
+#if JUCE_LINUX
+    static auto const pageSize = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    return pageSize;
+#else
+    return 64U;
+#endif
+}
+
+auto MirroredMapping::release() noexcept -> void
+{
+    if (_data == nullptr) { return; }
+
+#if JUCE_LINUX
+    if (_mirrored) { ::munmap(_data, _size * 2U); }
+    else { ::operator delete(_data, std::align_val_t{64}); }
+#else
+    ::operator delete(_data, std::align_val_t{64});
+#endif
+
+    _data     = nullptr;
+    _size     = 0;
+    _mirrored = false;
+}
+
+}  // namespace lt::detail
\ No newline at end of file
@@ -0,0 +1,388 @@
+#pragma once
+
+namespace lt
+{
+
+namespace detail
+{
+
+/// \brief Memory region mapped twice, back to back in virtual memory.
+///
+/// \details Writes through one half show up in the other one, so any
+/// range of up to size() bytes starting in the first half is contiguous.
+/// The size is rounded up to granularity(). Platforms without support,
+/// or a failed mapping, fall back to a plain allocation of twice the
+/// size, mirrored() then returns false and the owner has to copy into
+/// both halves itself.
+struct MirroredMapping
+{
+    MirroredMapping() = default;
+    explicit MirroredMapping(std::size_t minBytes);
+    ~MirroredMapping();
+
+    MirroredMapping(MirroredMapping&& other) noexcept;
+    auto operator=(MirroredMapping&& other) noexcept -> MirroredMapping&;
+
+    MirroredMapping(MirroredMapping const& other)                    = delete;
+    auto operator=(MirroredMapping const& other) -> MirroredMapping& = delete;
+
+    [[nodiscard]] auto data() const noexcept -> void*;
+    [[nodiscard]] auto size() const noexcept -> std::size_t;
+    [[nodiscard]] auto mirrored() const noexcept -> bool;
+
+    /// \brief Size in bytes every mapping is a multiple of.
+    [[nodiscard]] static auto granularity() noexcept -> std::size_t;
+
+private:
+    auto release() noexcept -> void;
+
+    void* _data{nullptr};
+    std::size_t _size{0};
+    bool _mirrored{false};
+};
+
+}  // namespace detail
+
+/// \brief Fixed size window over the most recently written elements,
+/// stored in a double mapped ring.
+///
+/// \details Same interface and semantics as CircularBuffer, index 0 is
+/// the oldest element. The ring storage is mapped twice back to back, so
+/// the window is always one contiguous range starting at data(). Frames
+/// for an FFT or a convolution can be read in place, without index math
+/// or split segments, and write() is a single copy.
+///
+/// The ring capacity is rounded up to the page size, allocation and
+/// resizing are not realtime safe. Only trivially copyable types are
+/// supported.
+template<typename T>
+struct MirroredCircularBuffer
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+
+    using value_type             = T;
+    using reference              = value_type&;
+    using const_reference        = value_type const&;
+    using pointer                = value_type*;
+    using const_pointer          = value_type const*;
+    using size_type              = std::uint32_t;
+    using iterator               = pointer;
+    using const_iterator         = const_pointer;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    MirroredCircularBuffer() = default;
+    explicit MirroredCircularBuffer(size_type size, value_type val = {});
+
+    [[nodiscard]] auto empty() const noexcept -> bool;
+    [[nodiscard]] auto size() const noexcept -> size_type;
+
+    /// \brief Number of elements in one half of the mapping, at least size().
+    [[nodiscard]] auto capacity() const noexcept -> size_type;
+
+    /// \brief False if the storage fell back to copying into both halves.
+    [[nodiscard]] auto isMirrored() const noexcept -> bool;
+
+    /// \brief Oldest element, followed by the rest of the window in order.
+    [[nodiscard]] auto data() noexcept -> pointer;
+    [[nodiscard]] auto data() const noexcept -> const_pointer;
+
+    [[nodiscard]] auto begin() noexcept -> iterator;
+    [[nodiscard]] auto begin() const noexcept -> const_iterator;
+    [[nodiscard]] auto cbegin() const noexcept -> const_iterator;
+
+    [[nodiscard]] auto end() noexcept -> iterator;
+    [[nodiscard]] auto end() const noexcept -> const_iterator;
+    [[nodiscard]] auto cend() const noexcept -> const_iterator;
+
+    [[nodiscard]] auto operator[](size_type index) -> reference;
+    [[nodiscard]] auto operator[](size_type index) const -> const_reference;
+
+    /// \brief The whole buffer, always a single segment.
+    [[nodiscard]] auto segments() noexcept -> RingSegments<value_type>;
+    [[nodiscard]] auto segments() const noexcept -> RingSegments<value_type const>;
+
+    /// \brief count elements starting at the given index, always a single segment.
+    [[nodiscard]] auto segments(size_type index, size_type count) noexcept -> RingSegments<value_type>;
+    [[nodiscard]] auto segments(size_type index, size_type count) const noexcept -> RingSegments<value_type const>;
+
+    auto push_back(const_reference val) -> void;
+
+    /// \brief Appends all values, same as calling push_back for each one.
+    auto write(Span<value_type const> values) -> void;
+
+    /// \brief Copies the oldest values and shifts in value initialized elements.
+    auto read(Span<value_type> values) -> void;
+
+    /// \brief Copies values starting at the given index, without modifying the buffer.
+    auto peek(Span<value_type> values, size_type offset = 0) const -> void;
+
+    /// \brief Copies all elements from oldest to newest, values must hold size() elements.
+    auto copyTo(Span<value_type> values) const -> void;
+
+    /// \brief Same as CircularBuffer::resize(), elements added in front are
+    /// value initialized. Only allocates if newSize exceeds capacity().
+    auto resize(size_type newSize, ResizeMode mode = ResizeMode::keepNewest) -> void;
+    auto clear() -> void;
+
+private:
+    auto storage() const noexcept -> pointer;
+    auto fillRing(size_type first, size_type count, value_type val) -> void;
+    auto commit(size_type count) -> void;
+
+    detail::MirroredMapping _mapping{};
+    size_type _size{0};
+    size_type _capacity{0};
+    size_type _writeIndex{0};
+};
+
+template<typename T>
+MirroredCircularBuffer<T>::MirroredCircularBuffer(size_type size, value_type val)
+    : _mapping{static_cast<std::size_t>(size) * sizeof(value_type)}
+    , _size{size}
+    , _capacity{narrowCast<size_type>(_mapping.size() / sizeof(value_type))}
+{
+    jassert(_mapping.size() % sizeof(value_type) == 0U);
+    jassert(_capacity >= _size);
+
+    // Both halves, the second one only matters without a mirror.
+    std::fill(storage(), std::next(storage(), _capacity * 2U), val);
+}
+
+template<typename T>
+auto MirroredCircularBuffer<T>::empty() const noexcept -> bool
+{
+    return _size == 0U;
+}
+
+template<typename T>
+auto MirroredCircularBuffer<T>::size() const noexcept -> size_type
+{
+    return _size;
+}
+
+template<typename T>
+auto MirroredCircularBuffer<T>::capacity() const noexcept -> size_type
+{
+    return _capacity;
+}
+
+template<typename T>
+auto MirroredCircularBuffer<T>::isMirrored() const noexcept -> bool
+{
+    return _mapping.mirrored();
+}
+
+template<typename T>
+auto MirroredCircularBuffer<T>::data() noexcept -> pointer
+{
+    // The window ends at the write index, its start may lie one ring
+    // earlier, which is the same memory in the first half.
+    return std::next(storage(), _writeIndex + _capacity - _size);
+}
+
+template<typename T>
+auto MirroredCircularBuffer<T>::data() const noexcept -> const_pointer
+{
+    return std::next(storage(), _writeIndex + _capacity - _size);
+}
+
+template<typename T>
+auto MirroredCircularBuffer<T>::begin() noexcept -> iterator
+{
+    return data();
+}
+template<typename T>
+auto MirroredCircularBuffer<T>::end() noexcept -> iterator
+{
+    return std::next(data(), _size);
+}
+
+template<typename T>
+auto MirroredCircularBuffer<T>::begin() const noexcept -> const_iterator
+{
+    return data();
+}
+template<typename T>
+auto MirroredCircularBuffer<T>::end() const noexcept -> const_iterator
+{
+    return std::next(data(), _size);
+}
+
+template<typename T>
+auto MirroredCircularBuffer<T>::cbegin() const noexcept -> const_iterator
+{
+    return data();
+}
+template<typename T>
+auto MirroredCircularBuffer<T>::cend() const noexcept -> const_iterator
+{
+    return std::next(data(), _size);
+}
+
+template<typename T>
+auto MirroredCircularBuffer<T>::operator[](size_type index) -> reference
+{
+    jassert(index < size());
+    return data()[index];
+}
+
+template<typename T>
+auto MirroredCircularBuffer<T>::operator[](size_type index) const -> const_reference
+{
+    jassert(index < size());
+    return data()[index];
+}
+
+template<typename T>
+auto MirroredCircularBuffer<T>::segments() noexcept -> RingSegments<value_type>
+{
+    return segments(0, size());
+}
+
+template<typename T>
+auto MirroredCircularBuffer<T>::segments() const noexcept -> RingSegments<value_type const>
+{
+    return segments(0, size());
+}
+
+template<typename T>
+auto MirroredCircularBuffer<T>::segments(size_type index, size_type count) noexcept -> RingSegments<value_type>
+{
+    jassert(index + count <= size());
+    return {Span<value_type>{std::next(data(), index), count}, {}};
+}
+
+template<typename T>
+auto MirroredCircularBuffer<T>::segments(size_type index, size_type count) const noexcept
+    -> RingSegments<value_type const>
+{
+    jassert(index + count <= size());
+    return {Span<value_type const>{std::next(data(), index), count}, {}};
+}
+
+template<typename T>
+auto MirroredCircularBuffer<T>::push_back(const_reference val) -> void
+{
+    jassert(size() != 0U);
+    storage()[_writeIndex] = val;
+    commit(1U);
+}
+
+template<typename T>
+auto MirroredCircularBuffer<T>::write(Span<value_type const> values) -> void
+{
+    jassert(size() != 0U);
+
+    // Only the last size() values survive.
+    if (std::size(values) > size()) { values = values.last(size()); }
+
+    std::copy(std::begin(values), std::end(values), std::next(storage(), _writeIndex));
+    commit(narrowCast<size_type>(std::size(values)));
+}
+
+template<typename T>
+auto MirroredCircularBuffer<T>::read(Span<value_type> values) -> void
+{
+    jassert(std::size(values) <= size());
+
+    peek(values);
+
+    // The oldest elements become the newest ones.
+    auto const count = narrowCast<size_type>(std::size(values));
+    std::fill(std::next(storage(), _writeIndex), std::next(storage(), _writeIndex + count), value_type{});
+    commit(count);
+}
+
+template<typename T>
+auto MirroredCircularBuffer<T>::peek(Span<value_type> values, size_type offset) const -> void
+{
+    jassert(offset + std::size(values) <= size());
+
+    auto const* first = std::next(data(), offset);
+    std::copy(first, std::next(first, std::size(values)), std::begin(values));
+}
+
+template<typename T>
+auto MirroredCircularBuffer<T>::copyTo(Span<value_type> values) const -> void
+{
+    jassert(std::size(values) == size());
+    peek(values);
+}
+
+template<typename T>
+auto MirroredCircularBuffer<T>::resize(size_type newSize, ResizeMode mode) -> void
+{
+    if (newSize > _capacity)
+    {
+        // Keep the current window as the newest values of the larger one.
+        auto larger = MirroredCircularBuffer{newSize};
+        if (mode == ResizeMode::keepNewest && !empty()) { larger.write(Span<value_type const>{data(), size()}); }
+        *this = std::move(larger);
+        return;
+    }
+
+    if (mode == ResizeMode::clear)
+    {
+        fillRing(0U, _capacity, value_type{});
+        _writeIndex = 0;
+    }
+    else if (newSize > _size)
+    {
+        // The ring still holds older values in front of the window, they
+        // must not show up in it.
+        fillRing((_writeIndex + _capacity - newSize) % _capacity, newSize - _size, value_type{});
+    }
+
+    _size = newSize;
+}
+
+template<typename T>
+auto MirroredCircularBuffer<T>::clear() -> void
+{
+    _mapping    = detail::MirroredMapping{};
+    _size       = 0;
+    _capacity   = 0;
+    _writeIndex = 0;
+}
+
+template<typename T>
+auto MirroredCircularBuffer<T>::storage() const noexcept -> pointer
+{
+    return static_cast<pointer>(_mapping.data());
+}
+
+template<typename T>
+auto MirroredCircularBuffer<T>::fillRing(size_type first, size_type count, value_type val) -> void
+{
+    // Without a mirror both halves hold a copy of the ring.
+    auto* const ring   = storage();
+    auto const middle  = std::min(first + count, _capacity);
+    auto const wrapped = first + count - middle;
+    auto const fill    = [=](size_type half) {
+        std::fill(std::next(ring, half + first), std::next(ring, half + middle), val);
+        std::fill(std::next(ring, half), std::next(ring, half + wrapped), val);
+    };
+
+    fill(0U);
+    if (!isMirrored()) { fill(_capacity); }
+}
+
+template<typename T>
+auto MirroredCircularBuffer<T>::commit(size_type count) -> void
+{
+    // Written at [writeIndex, writeIndex + count) of the lower ring, the
+    // part past its end is the start of the upper one.
+    auto const end = _writeIndex + count;
+    if (!isMirrored())
+    {
+        auto* const ring  = storage();
+        auto const middle = std::min(end, _capacity);
+        std::copy(std::next(ring, _writeIndex), std::next(ring, middle), std::next(ring, _writeIndex + _capacity));
+        std::copy(std::next(ring, _capacity), std::next(ring, std::max(end, _capacity)), ring);
+    }
+
+    _writeIndex = end >= _capacity ? end - _capacity : end;
+}
+
+}  // namespace lt
\ No newline at end of file
@@ -0,0 +1,156 @@
+#include <lt_core/lt_core.hpp>
+
+#include "catch2/catch_template_test_macros.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+TEMPLATE_TEST_CASE("core/container: MirroredCircularBuffer", "[core][container]", short, int, float, double)
+{
+    using T = TestType;
+
+    SECTION("default construct")
+    {
+        auto cb = lt::MirroredCircularBuffer<T>{};
+        REQUIRE(cb.empty());
+        REQUIRE(cb.size() == 0U);
+        REQUIRE(cb.capacity() == 0U);
+    }
+
+    SECTION("capacity is rounded to the mapping granularity")
+    {
+        auto const granularity = lt::detail::MirroredMapping::granularity();
+
+        auto cb = lt::MirroredCircularBuffer<T>{1000U, T{}};
+        REQUIRE(cb.size() == 1000U);
+        REQUIRE(cb.capacity() >= cb.size());
+        REQUIRE((cb.capacity() * sizeof(T)) % granularity == 0U);
+
+#if JUCE_LINUX
+        REQUIRE(cb.isMirrored());
+#endif
+    }
+
+    SECTION("window is contiguous")
+    {
+        auto cb = lt::MirroredCircularBuffer<T>{3U, T{}};
+        for (auto i{1}; i <= 5; ++i) { cb.push_back(static_cast<T>(i)); }
+
+        REQUIRE(cb[0] == T{3});
+        REQUIRE(cb[1] == T{4});
+        REQUIRE(cb[2] == T{5});
+        REQUIRE(std::distance(std::cbegin(cb), std::cend(cb)) == 3);
+        REQUIRE(std::next(cb.data(), 2) == &cb[2]);
+
+        auto const segments = cb.segments(1U, 2U);
+        REQUIRE(std::data(segments.first) == &cb[1]);
+        REQUIRE(std::size(segments.first) == 2U);
+        REQUIRE(std::empty(segments.second));
+
+        // Wrap the write index around the end of the ring.
+        auto values = std::vector<T>(cb.capacity());
+        std::iota(std::begin(values), std::end(values), T{0});
+        cb.write(lt::Span<T const>{values}.first(cb.capacity() - 1U));
+        cb.write(lt::Span<T const>{values}.first(2U));
+
+        auto const* data = cb.data();
+        REQUIRE(data[0] == static_cast<T>(cb.capacity() - 2U));
+        REQUIRE(data[1] == T{0});
+        REQUIRE(data[2] == T{1});
+    }
+
+    SECTION("matches CircularBuffer")
+    {
+        auto const size = GENERATE(1U, 7U, 64U, 1000U, 5000U);
+
+        auto mirrored = lt::MirroredCircularBuffer<T>{size, T{}};
+        auto wrapped  = lt::CircularBuffer<T>{size, T{}};
+
+        auto values = std::vector<T>(12000U);
+        std::iota(std::begin(values), std::end(values), T{0});
+
+        auto const matches = [&] {
+            return std::equal(std::cbegin(mirrored), std::cend(mirrored), std::cbegin(wrapped), std::cend(wrapped));
+        };
+
+        for (auto chunk : {1U, 3U, 500U, 13U, 4096U, 70U, 11000U, 7U, 999U})
+        {
+            auto const input = lt::Span<T const>{values}.first(chunk);
+            mirrored.write(input);
+            wrapped.write(input);
+            REQUIRE(matches());
+
+            mirrored.push_back(T{-1});
+            wrapped.push_back(T{-1});
+            REQUIRE(matches());
+
+            auto const count = std::min(chunk, size);
+            auto fromMirrored = std::vector<T>(count);
+            auto fromWrapped  = std::vector<T>(count);
+            mirrored.read(lt::Span<T>{fromMirrored});
+            wrapped.read(lt::Span<T>{fromWrapped});
+            REQUIRE(fromMirrored == fromWrapped);
+            REQUIRE(matches());
+
+            auto const offset = size / 3U;
+            auto peeked       = std::vector<T>(size - offset);
+            mirrored.peek(lt::Span<T>{peeked}, offset);
+            REQUIRE(std::equal(std::cbegin(peeked), std::cend(peeked), std::next(std::cbegin(wrapped), offset)));
+        }
+    }
+
+    SECTION("resize keeps the newest values")
+    {
+        auto cb = lt::MirroredCircularBuffer<T>{4U, T{}};
+        for (auto i{1}; i <= 6; ++i) { cb.push_back(static_cast<T>(i)); }
+
+        auto const newSize = cb.capacity() * 2U;
+        cb.resize(newSize);
+        REQUIRE(cb.size() == newSize);
+        REQUIRE(cb.capacity() >= newSize);
+        REQUIRE(cb[cb.size() - 1U] == T{6});
+        REQUIRE(cb[cb.size() - 4U] == T{3});
+        REQUIRE(cb[0] == T{0});
+
+        cb.clear();
+        REQUIRE(cb.empty());
+        REQUIRE(cb.capacity() == 0U);
+    }
+
+    SECTION("resize within the capacity matches CircularBuffer")
+    {
+        auto cb       = lt::MirroredCircularBuffer<T>{8U, T{}};
+        auto expected = lt::CircularBuffer<T>{8U, T{}};
+        for (auto i{1}; i <= 11; ++i)
+        {
+            cb.push_back(static_cast<T>(i));
+            expected.push_back(static_cast<T>(i));
+        }
+
+        // Growing after a shrink must not expose the values dropped before.
+        for (auto newSize : {3U, 8U, 2U, 6U})
+        {
+            cb.resize(newSize);
+            expected.resize(newSize);
+            REQUIRE(cb.capacity() > 8U);
+            REQUIRE(std::equal(std::cbegin(cb), std::cend(cb), std::cbegin(expected), std::cend(expected)));
+        }
+
+        cb.push_back(T{42});
+        cb.resize(5U, lt::ResizeMode::clear);
+        REQUIRE(cb.size() == 5U);
+        REQUIRE(std::all_of(std::cbegin(cb), std::cend(cb), [](auto v) { return v == T{}; }));
+
+        cb.push_back(T{7});
+        REQUIRE(cb[4] == T{7});
+        REQUIRE(cb[3] == T{});
+    }
+
+    SECTION("move")
+    {
+        auto cb = lt::MirroredCircularBuffer<T>{16U, T{}};
+        cb.push_back(T{42});
+
+        auto moved = std::move(cb);
+        REQUIRE(moved.size() == 16U);
+        REQUIRE(moved[15] == T{42});
+    }
+}
\ No newline at end of file
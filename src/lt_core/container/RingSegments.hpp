@@ -0,0 +1,65 @@
+#pragma once
+
+namespace lt
+{
+
+/// \brief A logical range of a ring buffer as up to two contiguous
+/// spans, in order. second is empty if the range does not wrap.
+///
+/// \details The algorithms below run the std algorithm once per span,
+/// on raw pointers, so copies become memmove and loops can vectorize.
+template<typename T>
+struct RingSegments
+{
+    Span<T> first{};
+    Span<T> second{};
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return std::size(first) + std::size(second); }
+    [[nodiscard]] auto empty() const noexcept -> bool { return size() == 0U; }
+};
+
+/// \brief Calls func(span, offset) for each non empty segment, offset is
+/// the logical index of the span's first element.
+template<typename T, typename Func>
+auto forEachSegment(RingSegments<T> segments, Func func) -> void
+{
+    if (!std::empty(segments.first)) { func(segments.first, std::size_t{0}); }
+    if (!std::empty(segments.second)) { func(segments.second, std::size(segments.first)); }
+}
+
+/// \brief Copies the segments in order to out.
+template<typename T, typename OutputIt>
+auto copySegments(RingSegments<T> segments, OutputIt out) -> OutputIt
+{
+    out = std::copy(std::begin(segments.first), std::end(segments.first), out);
+    return std::copy(std::begin(segments.second), std::end(segments.second), out);
+}
+
+/// \brief Fills the segments in order from in, returns the end of the consumed input.
+template<typename InputIt, typename T>
+auto copySegments(InputIt in, RingSegments<T> segments) -> InputIt
+{
+    forEachSegment(segments, [&in](auto span, auto /*offset*/) {
+        std::copy_n(in, std::size(span), std::begin(span));
+        std::advance(in, std::size(span));
+    });
+    return in;
+}
+
+/// \brief std::accumulate over the segments in order.
+template<typename T, typename Init, typename BinaryOp = std::plus<>>
+[[nodiscard]] auto accumulateSegments(RingSegments<T> segments, Init init, BinaryOp op = {}) -> Init
+{
+    init = std::accumulate(std::begin(segments.first), std::end(segments.first), std::move(init), op);
+    return std::accumulate(std::begin(segments.second), std::end(segments.second), std::move(init), op);
+}
+
+/// \brief std::transform of the segments in order to out.
+template<typename T, typename OutputIt, typename UnaryOp>
+auto transformSegments(RingSegments<T> segments, OutputIt out, UnaryOp op) -> OutputIt
+{
+    out = std::transform(std::begin(segments.first), std::end(segments.first), out, op);
+    return std::transform(std::begin(segments.second), std::end(segments.second), out, op);
+}
+
+}  // namespace lt
\ No newline at end of file
@@ -0,0 +1,58 @@
+#include <lt_core/lt_core.hpp>
+
+#include "catch2/catch_template_test_macros.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+TEMPLATE_TEST_CASE("core/container: RingSegments", "[core][container]", int, float, double)
+{
+    using T = TestType;
+
+    auto storage = std::vector<T>{5, 6, 7, 1, 2, 3, 4};
+    auto const segments
+        = lt::RingSegments<T>{lt::Span<T>{storage}.subspan(3U), lt::Span<T>{storage}.first(3U)};
+
+    REQUIRE(segments.size() == 7U);
+    REQUIRE_FALSE(segments.empty());
+    REQUIRE(lt::RingSegments<T>{}.empty());
+
+    SECTION("forEachSegment")
+    {
+        auto offsets = std::vector<std::size_t>{};
+        auto sizes   = std::vector<std::size_t>{};
+        lt::forEachSegment(segments, [&](lt::Span<T> span, std::size_t offset) {
+            offsets.push_back(offset);
+            sizes.push_back(std::size(span));
+        });
+        REQUIRE(offsets == std::vector<std::size_t>{0, 4});
+        REQUIRE(sizes == std::vector<std::size_t>{4, 3});
+
+        // Empty segments are skipped.
+        auto calls = 0;
+        lt::forEachSegment(lt::RingSegments<T>{segments.first, {}}, [&](auto, auto) { ++calls; });
+        REQUIRE(calls == 1);
+    }
+
+    SECTION("copySegments")
+    {
+        auto out = std::vector<T>(7U);
+        REQUIRE(lt::copySegments(segments, std::begin(out)) == std::end(out));
+        REQUIRE(out == std::vector<T>{1, 2, 3, 4, 5, 6, 7});
+
+        auto const in = std::vector<T>{10, 20, 30, 40, 50, 60, 70};
+        REQUIRE(lt::copySegments(std::cbegin(in), segments) == std::cend(in));
+        REQUIRE(storage == std::vector<T>{50, 60, 70, 10, 20, 30, 40});
+    }
+
+    SECTION("accumulateSegments")
+    {
+        REQUIRE(lt::accumulateSegments(segments, T{0}) == T{28});
+        REQUIRE(lt::accumulateSegments(segments, T{1}, std::multiplies<>{}) == T{5040});
+    }
+
+    SECTION("transformSegments")
+    {
+        auto out = std::vector<T>(7U);
+        lt::transformSegments(segments, std::begin(out), [](T x) { return x * T{2}; });
+        REQUIRE(out == std::vector<T>{2, 4, 6, 8, 10, 12, 14});
+    }
+}
\ No newline at end of file
@@ -0,0 +1,145 @@
+#include "lt_core/lt_core.hpp"
+
+#include <benchmark/benchmark.h>
+#include <concurrentqueue.h>
+
+#include <thread>
+
+static constexpr auto benchmarkNumChannels = 2U;
+static constexpr auto benchmarkCapacity    = 8192U;
+
+namespace
+{
+
+/// Planar stereo blocks through lt::SpscRingBuffer.
+struct SpscRingChannel
+{
+    explicit SpscRingChannel(std::uint32_t blockSize)
+        : _ring{benchmarkNumChannels, benchmarkCapacity}
+        , _send(benchmarkNumChannels * blockSize, 1.0F)
+        , _receive(benchmarkNumChannels * blockSize)
+        , _blockSize{blockSize}
+    {
+    }
+
+    auto send() -> void
+    {
+        for (auto done{0U}; done < _blockSize;)
+        {
+            auto const channels = std::array<float const*, benchmarkNumChannels>{
+                std::next(_send.data(), done),
+                std::next(_send.data(), _blockSize + done),
+            };
+            auto const count = _ring.write(lt::Span<float const* const>{channels}, _blockSize - done);
+            if (count == 0U) { std::this_thread::yield(); }
+            done += count;
+        }
+    }
+
+    auto receive() -> void
+    {
+        for (auto done{0U}; done < _blockSize;)
+        {
+            auto const channels = std::array<float*, benchmarkNumChannels>{
+                std::next(_receive.data(), done),
+                std::next(_receive.data(), _blockSize + done),
+            };
+            auto const count = _ring.read(lt::Span<float* const>{channels}, _blockSize - done);
+            if (count == 0U) { std::this_thread::yield(); }
+            done += count;
+        }
+        benchmark::DoNotOptimize(_receive.data());
+    }
+
+private:
+    lt::SpscRingBuffer<float> _ring;
+    std::vector<float> _send;
+    std::vector<float> _receive;
+    std::uint32_t _blockSize;
+};
+
+/// Interleaved stereo blocks through moodycamel::ConcurrentQueue, using
+/// tokens and the non-allocating bulk functions.
+struct ConcurrentQueueChannel
+{
+    explicit ConcurrentQueueChannel(std::uint32_t blockSize)
+        : _queue{benchmarkNumChannels * benchmarkCapacity}
+        , _producer{_queue}
+        , _consumer{_queue}
+        , _send(benchmarkNumChannels * blockSize, 1.0F)
+        , _receive(benchmarkNumChannels * blockSize)
+    {
+    }
+
+    auto send() -> void
+    {
+        while (!_queue.try_enqueue_bulk(_producer, _send.data(), _send.size())) { std::this_thread::yield(); }
+    }
+
+    auto receive() -> void
+    {
+        for (auto done = std::size_t{0}; done < _receive.size();)
+        {
+            auto const count
+                = _queue.try_dequeue_bulk(_consumer, std::next(_receive.data(), done), _receive.size() - done);
+            if (count == 0U) { std::this_thread::yield(); }
+            done += count;
+        }
+        benchmark::DoNotOptimize(_receive.data());
+    }
+
+private:
+    moodycamel::ConcurrentQueue<float> _queue;
+    moodycamel::ProducerToken _producer;
+    moodycamel::ConsumerToken _consumer;
+    std::vector<float> _send;
+    std::vector<float> _receive;
+};
+
+}  // namespace
+
+template<typename Channel>
+static void lt_SpscRingBuffer_Throughput(benchmark::State& state)
+{
+    auto const blockSize = static_cast<std::uint32_t>(state.range(0));
+    auto channel         = Channel{blockSize};
+
+    // The producer sends exactly the blocks the timed loop receives.
+    auto producer = std::thread{[&channel, blocks = state.max_iterations] {
+        for (auto i = benchmark::IterationCount{0}; i < blocks; ++i) { channel.send(); }
+    }};
+
+    for (auto _ : state) { channel.receive(); }
+
+    producer.join();
+    state.SetItemsProcessed(state.iterations() * state.range(0) * benchmarkNumChannels);
+}
+BENCHMARK_TEMPLATE(lt_SpscRingBuffer_Throughput, SpscRingChannel)->Arg(64)->Arg(512)->UseRealTime();
+BENCHMARK_TEMPLATE(lt_SpscRingBuffer_Throughput, ConcurrentQueueChannel)->Arg(64)->Arg(512)->UseRealTime();
+
+template<typename Channel>
+static void lt_SpscRingBuffer_RoundTrip(benchmark::State& state)
+{
+    auto const blockSize = static_cast<std::uint32_t>(state.range(0));
+    auto request         = Channel{blockSize};
+    auto response        = Channel{blockSize};
+
+    // Echoes every block back, one iteration is one round trip.
+    auto worker = std::thread{[&request, &response, blocks = state.max_iterations] {
+        for (auto i = benchmark::IterationCount{0}; i < blocks; ++i)
+        {
+            request.receive();
+            response.send();
+        }
+    }};
+
+    for (auto _ : state)
+    {
+        request.send();
+        response.receive();
+    }
+
+    worker.join();
+}
+BENCHMARK_TEMPLATE(lt_SpscRingBuffer_RoundTrip, SpscRingChannel)->Arg(64)->Arg(512)->UseRealTime();
+BENCHMARK_TEMPLATE(lt_SpscRingBuffer_RoundTrip, ConcurrentQueueChannel)->Arg(64)->Arg(512)->UseRealTime();
\ No newline at end of file
@@ -0,0 +1,202 @@
+#pragma once
+
+#include <atomic>
+#include <bit>
+
+namespace lt
+{
+
+/// \brief Wait-free single producer, single consumer ring of planar
+/// multichannel frames.
+///
+/// \details Meant for streaming audio between the realtime thread and a
+/// worker, one thread writes and one thread reads. Every channel shares
+/// the same indices, so a frame is published for all channels at once.
+/// write() and read() never block, they transfer as many frames as fit
+/// or are available and return that count.
+///
+/// The capacity is rounded up to a power of two. The indices are free
+/// running and masked on access, each one lives on its own cache line,
+/// next to a cached copy of the other side's index, which keeps the
+/// shared lines from bouncing on every call. Construction and reset()
+/// are not thread safe.
+template<typename T>
+struct SpscRingBuffer
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+
+    using value_type = T;
+    using size_type  = std::uint32_t;
+
+    SpscRingBuffer(size_type numChannels, size_type minCapacity);
+
+    [[nodiscard]] auto numChannels() const noexcept -> size_type;
+    [[nodiscard]] auto capacity() const noexcept -> size_type;
+
+    /// \brief Frames that can be written, only exact on the producer thread.
+    [[nodiscard]] auto availableToWrite() const noexcept -> size_type;
+
+    /// \brief Frames that can be read, only exact on the consumer thread.
+    [[nodiscard]] auto availableToRead() const noexcept -> size_type;
+
+    /// \brief Writes up to numFrames frames, one pointer per channel.
+    /// Returns the number of frames written. Producer thread only.
+    auto write(Span<value_type const* const> channels, size_type numFrames) -> size_type;
+
+    /// \brief Reads up to numFrames frames, one pointer per channel.
+    /// Returns the number of frames read. Consumer thread only.
+    auto read(Span<value_type* const> channels, size_type numFrames) -> size_type;
+
+    /// \brief Single channel write(), the ring must have one channel.
+    auto write(Span<value_type const> values) -> size_type;
+
+    /// \brief Single channel read(), the ring must have one channel.
+    auto read(Span<value_type> values) -> size_type;
+
+    /// \brief Drops all frames, neither side may be running.
+    auto reset() -> void;
+
+private:
+    [[nodiscard]] auto channel(size_type index) noexcept -> value_type*;
+
+    std::vector<value_type> _buffer{};
+    size_type _numChannels;
+    size_type _capacity;
+    size_type _mask;
+
+    // Producer side, the cached read index is only touched by the producer
+    // and shares the line with the write index.
+    alignas(64) std::atomic<size_type> _writeIndex{0};
+    size_type _cachedReadIndex{0};
+
+    // Consumer side, the cached write index is only touched by the consumer
+    // and shares the line with the read index.
+    alignas(64) std::atomic<size_type> _readIndex{0};
+    size_type _cachedWriteIndex{0};
+};
+
+template<typename T>
+SpscRingBuffer<T>::SpscRingBuffer(size_type numChannels, size_type minCapacity)
+    : _numChannels{numChannels}
+    , _capacity{std::bit_ceil(std::max(minCapacity, 1U))}
+    , _mask{_capacity - 1U}
+{
+    jassert(numChannels > 0U);
+    jassert(_capacity <= (1U << 31U));
+    _buffer.assign(static_cast<std::size_t>(_numChannels) * _capacity, value_type{});
+}
+
+template<typename T>
+auto SpscRingBuffer<T>::numChannels() const noexcept -> size_type
+{
+    return _numChannels;
+}
+
+template<typename T>
+auto SpscRingBuffer<T>::capacity() const noexcept -> size_type
+{
+    return _capacity;
+}
+
+template<typename T>
+auto SpscRingBuffer<T>::availableToWrite() const noexcept -> size_type
+{
+    auto const writeIndex = _writeIndex.load(std::memory_order_relaxed);
+    return _capacity - (writeIndex - _readIndex.load(std::memory_order_acquire));
+}
+
+template<typename T>
+auto SpscRingBuffer<T>::availableToRead() const noexcept -> size_type
+{
+    auto const readIndex = _readIndex.load(std::memory_order_relaxed);
+    return _writeIndex.load(std::memory_order_acquire) - readIndex;
+}
+
+template<typename T>
+auto SpscRingBuffer<T>::write(Span<value_type const* const> channels, size_type numFrames) -> size_type
+{
+    jassert(std::size(channels) == _numChannels);
+
+    // Indices are free running, unsigned wrap around keeps the
+    // difference correct because the capacity is a power of two.
+    auto const writeIndex = _writeIndex.load(std::memory_order_relaxed);
+    if (_capacity - (writeIndex - _cachedReadIndex) < numFrames)
+    {
+        _cachedReadIndex = _readIndex.load(std::memory_order_acquire);
+    }
+
+    auto const count = std::min(numFrames, _capacity - (writeIndex - _cachedReadIndex));
+    auto const start = writeIndex & _mask;
+    auto const first = std::min(count, _capacity - start);
+
+    for (auto ch{0U}; ch < _numChannels; ++ch)
+    {
+        auto const* const source = channels[ch];
+        auto* const ring         = channel(ch);
+        std::copy(source, std::next(source, first), std::next(ring, start));
+        std::copy(std::next(source, first), std::next(source, count), ring);
+    }
+
+    _writeIndex.store(writeIndex + count, std::memory_order_release);
+    return count;
+}
+
+template<typename T>
+auto SpscRingBuffer<T>::read(Span<value_type* const> channels, size_type numFrames) -> size_type
+{
+    jassert(std::size(channels) == _numChannels);
+
+    auto const readIndex = _readIndex.load(std::memory_order_relaxed);
+    if (_cachedWriteIndex - readIndex < numFrames)
+    {
+        _cachedWriteIndex = _writeIndex.load(std::memory_order_acquire);
+    }
+
+    auto const count = std::min(numFrames, _cachedWriteIndex - readIndex);
+    auto const start = readIndex & _mask;
+    auto const first = std::min(count, _capacity - start);
+
+    for (auto ch{0U}; ch < _numChannels; ++ch)
+    {
+        auto* const dest       = channels[ch];
+        auto const* const ring = channel(ch);
+        std::copy(std::next(ring, start), std::next(ring, start + first), dest);
+        std::copy(ring, std::next(ring, count - first), std::next(dest, first));
+    }
+
+    _readIndex.store(readIndex + count, std::memory_order_release);
+    return count;
+}
+
+template<typename T>
+auto SpscRingBuffer<T>::write(Span<value_type const> values) -> size_type
+{
+    jassert(_numChannels == 1U);
+    auto const* const data = std::data(values);
+    return write(Span<value_type const* const>{&data, 1U}, narrowCast<size_type>(std::size(values)));
+}
+
+template<typename T>
+auto SpscRingBuffer<T>::read(Span<value_type> values) -> size_type
+{
+    jassert(_numChannels == 1U);
+    auto* const data = std::data(values);
+    return read(Span<value_type* const>{&data, 1U}, narrowCast<size_type>(std::size(values)));
+}
+
+template<typename T>
+auto SpscRingBuffer<T>::reset() -> void
+{
+    _writeIndex.store(0, std::memory_order_relaxed);
+    _readIndex.store(0, std::memory_order_relaxed);
+    _cachedReadIndex  = 0;
+    _cachedWriteIndex = 0;
+}
+
+template<typename T>
+auto SpscRingBuffer<T>::channel(size_type index) noexcept -> value_type*
+{
+    return std::next(_buffer.data(), static_cast<std::ptrdiff_t>(index) * _capacity);
+}
+
+}  // namespace lt
\ No newline at end of file
@@ -0,0 +1,129 @@
+#include <lt_core/lt_core.hpp>
+
+#include "catch2/catch_template_test_macros.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+#include <thread>
+
+TEMPLATE_TEST_CASE("core/container: SpscRingBuffer", "[core][container]", int, float, double)
+{
+    using T = TestType;
+
+    SECTION("capacity is rounded to a power of two")
+    {
+        REQUIRE(lt::SpscRingBuffer<T>{1U, 0U}.capacity() == 1U);
+        REQUIRE(lt::SpscRingBuffer<T>{1U, 5U}.capacity() == 8U);
+        REQUIRE(lt::SpscRingBuffer<T>{2U, 512U}.capacity() == 512U);
+        REQUIRE(lt::SpscRingBuffer<T>{2U, 512U}.numChannels() == 2U);
+    }
+
+    SECTION("single channel")
+    {
+        auto ring = lt::SpscRingBuffer<T>{1U, 4U};
+        REQUIRE(ring.availableToRead() == 0U);
+        REQUIRE(ring.availableToWrite() == 4U);
+
+        auto const input = std::vector<T>{1, 2, 3, 4, 5, 6};
+        REQUIRE(ring.write(lt::Span<T const>{input}.first(3U)) == 3U);
+        REQUIRE(ring.availableToRead() == 3U);
+        REQUIRE(ring.availableToWrite() == 1U);
+
+        // Only one more frame fits.
+        REQUIRE(ring.write(lt::Span<T const>{input}.subspan(3U)) == 1U);
+        REQUIRE(ring.availableToWrite() == 0U);
+
+        auto output = std::vector<T>(2U);
+        REQUIRE(ring.read(lt::Span<T>{output}) == 2U);
+        REQUIRE(output == std::vector<T>{1, 2});
+
+        // Wraps around the end of the storage.
+        REQUIRE(ring.write(lt::Span<T const>{input}.subspan(4U)) == 2U);
+        output.resize(6U);
+        REQUIRE(ring.read(lt::Span<T>{output}) == 4U);
+        REQUIRE(std::vector<T>(output.begin(), output.begin() + 4) == std::vector<T>{3, 4, 5, 6});
+        REQUIRE(ring.availableToRead() == 0U);
+        REQUIRE(ring.read(lt::Span<T>{output}) == 0U);
+
+        ring.write(lt::Span<T const>{input});
+        ring.reset();
+        REQUIRE(ring.availableToRead() == 0U);
+        REQUIRE(ring.availableToWrite() == 4U);
+    }
+
+    SECTION("planar channels share indices")
+    {
+        auto ring = lt::SpscRingBuffer<T>{2U, 8U};
+
+        auto left  = std::vector<T>{1, 2, 3, 4, 5};
+        auto right = std::vector<T>{-1, -2, -3, -4, -5};
+        auto in    = std::array<T const*, 2>{left.data(), right.data()};
+
+        for (auto round{0}; round < 3; ++round)
+        {
+            REQUIRE(ring.write(lt::Span<T const* const>{in}, 5U) == 5U);
+
+            auto outLeft  = std::vector<T>(5U);
+            auto outRight = std::vector<T>(5U);
+            auto out      = std::array<T*, 2>{outLeft.data(), outRight.data()};
+            REQUIRE(ring.read(lt::Span<T* const>{out}, 5U) == 5U);
+            REQUIRE(outLeft == left);
+            REQUIRE(outRight == right);
+        }
+    }
+
+    SECTION("streams between two threads")
+    {
+        static constexpr auto const numChannels = 2U;
+        static constexpr auto const numFrames   = 100'000U;
+
+        auto ring = lt::SpscRingBuffer<T>{numChannels, 64U};
+
+        auto producer = std::thread{[&ring] {
+            auto blocks = std::array<std::vector<T>, numChannels>{};
+            for (auto& block : blocks) { block.resize(37U); }
+
+            for (auto frame{0U}; frame < numFrames;)
+            {
+                auto const count = std::min(37U, numFrames - frame);
+                for (auto i{0U}; i < count; ++i)
+                {
+                    blocks[0][i] = static_cast<T>((frame + i) % 1000U);
+                    blocks[1][i] = -static_cast<T>((frame + i) % 1000U);
+                }
+
+                for (auto written{0U}; written < count;)
+                {
+                    auto const channels = std::array<T const*, numChannels>{
+                        std::next(blocks[0].data(), written),
+                        std::next(blocks[1].data(), written),
+                    };
+                    auto const n = ring.write(lt::Span<T const* const>{channels}, count - written);
+                    written += n;
+                    if (n == 0U) { std::this_thread::yield(); }
+                }
+                frame += count;
+            }
+        }};
+
+        // Catch assertions are not thread safe, only check on this thread.
+        auto left     = std::vector<T>(23U);
+        auto right    = std::vector<T>(23U);
+        auto channels = std::array<T*, numChannels>{left.data(), right.data()};
+        auto mismatch = 0U;
+        for (auto frame{0U}; frame < numFrames;)
+        {
+            auto const n = ring.read(lt::Span<T* const>{channels}, 23U);
+            for (auto i{0U}; i < n; ++i)
+            {
+                auto const expected = static_cast<T>((frame + i) % 1000U);
+                if (left[i] != expected || right[i] != -expected) { ++mismatch; }
+            }
+            frame += n;
+            if (n == 0U) { std::this_thread::yield(); }
+        }
+
+        producer.join();
+        REQUIRE(mismatch == 0U);
+        REQUIRE(ring.availableToRead() == 0U);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+#pragma once
+
+namespace lt
+{
+
+/// \brief CircularBuffer with a compile time size and inline storage.
+///
+/// \details Shares element access and the bulk copies with
+/// CircularBuffer through CircularBufferBase, only reserve() and resize()
+/// are missing. The elements live in an aligned std::array inside the
+/// object, so there is no heap allocation and no pointer to follow, and
+/// an array of processors keeps all of its histories contiguous. clear()
+/// value initializes the elements, the size never changes.
+///
+/// Power of two sizes use MaskedIndex by default.
+template<typename T, std::uint32_t Size,
+         typename IndexPolicy = std::conditional_t<MaskedIndex::isValidSize(Size), MaskedIndex, WrappedIndex>>
+struct StaticCircularBuffer : CircularBufferBase<StaticCircularBuffer<T, Size, IndexPolicy>, T, IndexPolicy>
+{
+    static_assert(Size > 0U);
+    static_assert(IndexPolicy::isValidSize(Size));
+
+    using base_type = CircularBufferBase<StaticCircularBuffer, T, IndexPolicy>;
+    using typename base_type::size_type;
+    using typename base_type::value_type;
+
+    StaticCircularBuffer() = default;
+    explicit StaticCircularBuffer(value_type val);
+
+    [[nodiscard]] static constexpr auto empty() noexcept -> bool { return false; }
+    [[nodiscard]] static constexpr auto size() noexcept -> size_type { return Size; }
+    [[nodiscard]] static constexpr auto capacity() noexcept -> size_type { return Size; }
+
+    /// \brief Value initializes all elements.
+    auto clear() -> void;
+
+private:
+    friend base_type;
+
+    alignas(64) std::array<value_type, Size> _buffer{};
+};
+
+template<typename T, std::uint32_t Size, typename IndexPolicy>
+StaticCircularBuffer<T, Size, IndexPolicy>::StaticCircularBuffer(value_type val)
+{
+    _buffer.fill(val);
+}
+
+template<typename T, std::uint32_t Size, typename IndexPolicy>
+auto StaticCircularBuffer<T, Size, IndexPolicy>::clear() -> void
+{
+    _buffer.fill(value_type{});
+    this->_writeIndex = 0;
+}
+
+}  // namespace lt
\ No newline at end of file
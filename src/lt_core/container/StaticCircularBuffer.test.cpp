@@ -0,0 +1,90 @@
+#include <lt_core/lt_core.hpp>
+
+#include "catch2/catch_template_test_macros.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+#include <random>
+
+TEMPLATE_TEST_CASE("core/container: StaticCircularBuffer", "[core][container]", short, int, float, double)
+{
+    using T = TestType;
+
+    SECTION("storage")
+    {
+        STATIC_REQUIRE(std::is_same_v<typename lt::StaticCircularBuffer<T, 8>::index_policy, lt::MaskedIndex>);
+        STATIC_REQUIRE(std::is_same_v<typename lt::StaticCircularBuffer<T, 5>::index_policy, lt::WrappedIndex>);
+        STATIC_REQUIRE(std::is_trivially_copyable_v<lt::StaticCircularBuffer<T, 32>>);
+        STATIC_REQUIRE(alignof(lt::StaticCircularBuffer<T, 32>) == 64U);
+        STATIC_REQUIRE(lt::StaticCircularBuffer<T, 5>::size() == 5U);
+        STATIC_REQUIRE(lt::StaticCircularBuffer<T, 5>::capacity() == 5U);
+        STATIC_REQUIRE(std::random_access_iterator<typename lt::StaticCircularBuffer<T, 5>::iterator>);
+
+        auto cb = lt::StaticCircularBuffer<T, 3>{T(7)};
+        REQUIRE(!cb.empty());
+        REQUIRE(std::all_of(std::begin(cb), std::end(cb), [](auto v) { return v == T(7); }));
+
+        cb.push_back(1);
+        cb.clear();
+        REQUIRE(std::all_of(std::begin(cb), std::end(cb), [](auto v) { return v == T{}; }));
+    }
+
+    SECTION("push_back")
+    {
+        auto cb = lt::StaticCircularBuffer<T, 3>{};
+        cb.push_back(1);
+        cb.push_back(2);
+        cb.push_back(3);
+        cb.push_back(4);  // Overwrite 1 with 4.
+        REQUIRE(cb[0] == T{2});
+        REQUIRE(cb[1] == T{3});
+        REQUIRE(cb[2] == T{4});
+
+        auto const values = std::vector<T>(std::cbegin(cb), std::cend(cb));
+        REQUIRE(values == std::vector<T>{2, 3, 4});
+    }
+
+    SECTION("matches CircularBuffer")
+    {
+        auto check = [](auto staticBuffer) {
+            using StaticBuffer  = decltype(staticBuffer);
+            using DynamicBuffer = lt::CircularBuffer<T, typename StaticBuffer::index_policy>;
+
+            auto dynamicBuffer = DynamicBuffer{StaticBuffer::size()};
+            auto rng           = std::mt19937{42};
+            auto counts        = std::uniform_int_distribution<std::uint32_t>{0U, StaticBuffer::size() + 3U};
+            auto next          = T{0};
+
+            for (auto round{0}; round < 100; ++round)
+            {
+                auto values = std::vector<T>(counts(rng));
+                for (auto& value : values) { value = next++; }
+                staticBuffer.write(lt::Span<T const>{values});
+                dynamicBuffer.write(lt::Span<T const>{values});
+
+                auto const count = std::min(counts(rng), StaticBuffer::size());
+                auto fromStatic  = std::vector<T>(count);
+                auto fromDynamic = std::vector<T>(count);
+                staticBuffer.read(lt::Span<T>{fromStatic});
+                dynamicBuffer.read(lt::Span<T>{fromDynamic});
+                REQUIRE(fromStatic == fromDynamic);
+
+                staticBuffer.push_back(next);
+                dynamicBuffer.push_back(next++);
+                REQUIRE(std::equal(std::cbegin(staticBuffer), std::cend(staticBuffer), std::cbegin(dynamicBuffer)));
+
+                auto const segments = std::as_const(staticBuffer).segments(1U, StaticBuffer::size() - 1U);
+                auto copied         = std::vector<T>(segments.size());
+                lt::copySegments(segments, std::begin(copied));
+                REQUIRE(std::equal(std::cbegin(copied), std::cend(copied), std::next(std::cbegin(dynamicBuffer))));
+
+                auto all = std::vector<T>(StaticBuffer::size());
+                staticBuffer.copyTo(lt::Span<T>{all});
+                REQUIRE(std::equal(std::cbegin(all), std::cend(all), std::cbegin(dynamicBuffer)));
+            }
+        };
+
+        check(lt::StaticCircularBuffer<T, 5>{});
+        check(lt::StaticCircularBuffer<T, 8>{});
+        check(lt::StaticCircularBuffer<T, 8, lt::WrappedIndex>{});
+    }
+}
\ No newline at end of file
@@ -1,12 +1,22 @@
 #pragma once
 
+#include <compare>
+
 namespace lt
 {
 
+/// \brief Random access iterator over any container with operator[],
+/// stores the container and an index.
+///
+/// \details Models std::random_access_iterator, so std::next,
+/// std::distance and the std algorithms jump in O(1) instead of
+/// stepping one element at a time. A mutable iterator converts to the
+/// const one.
 template<typename Container, bool IsConst>
 struct IndexIterator
 {
     using iterator_category = std::random_access_iterator_tag;
+    using iterator_concept  = std::random_access_iterator_tag;
     using container_type    = std::conditional_t<IsConst, Container const, Container>;
     using index_type        = typename Container::size_type;
     using value_type        = typename Container::value_type;
@@ -14,10 +24,16 @@ struct IndexIterator
     using pointer           = std::conditional_t<IsConst, value_type const*, value_type*>;
     using reference         = std::conditional_t<IsConst, value_type const&, value_type&>;
 
+    IndexIterator() = default;
     IndexIterator(container_type* container, index_type index);
 
+    template<bool OtherIsConst>
+        requires(IsConst && !OtherIsConst)
+    IndexIterator(IndexIterator<Container, OtherIsConst> const& other);
+
     auto operator*() const -> reference;
-    auto operator->() -> pointer;
+    auto operator->() const -> pointer;
+    auto operator[](difference_type n) const -> reference;
 
     auto operator++() -> IndexIterator&;
     auto operator++(int) -> IndexIterator;
@@ -25,12 +41,15 @@ struct IndexIterator
     auto operator--() -> IndexIterator&;
     auto operator--(int) -> IndexIterator;
 
+    auto operator+=(difference_type n) -> IndexIterator&;
+    auto operator-=(difference_type n) -> IndexIterator&;
+
     [[nodiscard]] auto container() const -> container_type*;
     [[nodiscard]] auto index() const -> index_type;
 
 private:
-    container_type* _container;
-    index_type _index;
+    container_type* _container{nullptr};
+    index_type _index{0};
 };
 
 template<typename Container, bool IsConst>
@@ -39,6 +58,14 @@ IndexIterator<Container, IsConst>::IndexIterator(container_type* container, inde
 {
 }
 
+template<typename Container, bool IsConst>
+template<bool OtherIsConst>
+    requires(IsConst && !OtherIsConst)
+IndexIterator<Container, IsConst>::IndexIterator(IndexIterator<Container, OtherIsConst> const& other)
+    : _container{other.container()}, _index{other.index()}
+{
+}
+
 template<typename Container, bool IsConst>
 auto IndexIterator<Container, IsConst>::operator*() const -> reference
 {
@@ -46,11 +73,17 @@ auto IndexIterator<Container, IsConst>::operator*() const -> reference
 }
 
 template<typename Container, bool IsConst>
-auto IndexIterator<Container, IsConst>::operator->() -> pointer
+auto IndexIterator<Container, IsConst>::operator->() const -> pointer
 {
     return &(*_container)[_index];
 }
 
+template<typename Container, bool IsConst>
+auto IndexIterator<Container, IsConst>::operator[](difference_type n) const -> reference
+{
+    return *(*this + n);
+}
+
 template<typename Container, bool IsConst>
 auto IndexIterator<Container, IsConst>::operator++() -> IndexIterator&
 {
@@ -82,90 +115,75 @@ auto IndexIterator<Container, IsConst>::operator--(int) -> IndexIterator
 }
 
 template<typename Container, bool IsConst>
-auto IndexIterator<Container, IsConst>::container() const -> container_type*
-{
-    return _container;
-}
-
-template<typename Container, bool IsConst>
-auto IndexIterator<Container, IsConst>::index() const -> index_type
+auto IndexIterator<Container, IsConst>::operator+=(difference_type n) -> IndexIterator&
 {
-    return _index;
-}
-
-template<typename Container, bool IsConst>
-auto operator==(IndexIterator<Container, IsConst> const& lhs, IndexIterator<Container, IsConst> const& rhs) -> bool
-
-{
-    return lhs.index() == rhs.index();
+    // Unsigned wrap around handles negative offsets.
+    _index = static_cast<index_type>(_index + static_cast<index_type>(n));
+    return *this;
 }
 
 template<typename Container, bool IsConst>
-auto operator!=(IndexIterator<Container, IsConst> const& lhs, IndexIterator<Container, IsConst> const& rhs) -> bool
+auto IndexIterator<Container, IsConst>::operator-=(difference_type n) -> IndexIterator&
 {
-    return !(lhs == rhs);
+    _index = static_cast<index_type>(_index - static_cast<index_type>(n));
+    return *this;
 }
 
 template<typename Container, bool IsConst>
-auto operator<(IndexIterator<Container, IsConst> const& lhs, IndexIterator<Container, IsConst> const& rhs) -> bool
+auto IndexIterator<Container, IsConst>::container() const -> container_type*
 {
-    return lhs.index() < rhs.index();
+    return _container;
 }
 
 template<typename Container, bool IsConst>
-auto operator<=(IndexIterator<Container, IsConst> const& lhs, IndexIterator<Container, IsConst> const& rhs) -> bool
+auto IndexIterator<Container, IsConst>::index() const -> index_type
 {
-    return lhs.index() <= rhs.index();
+    return _index;
 }
 
-template<typename Container, bool IsConst>
-auto operator>(IndexIterator<Container, IsConst> const& lhs, IndexIterator<Container, IsConst> const& rhs) -> bool
+// The comparisons and the distance accept mixed constness, cb.begin() == cb.cend().
+template<typename Container, bool LhsIsConst, bool RhsIsConst>
+auto operator==(IndexIterator<Container, LhsIsConst> const& lhs, IndexIterator<Container, RhsIsConst> const& rhs)
+    -> bool
 {
-    return lhs.index() > rhs.index();
+    return lhs.index() == rhs.index();
 }
 
-template<typename Container, bool IsConst>
-auto operator>=(IndexIterator<Container, IsConst> const& lhs, IndexIterator<Container, IsConst> const& rhs) -> bool
+template<typename Container, bool LhsIsConst, bool RhsIsConst>
+auto operator<=>(IndexIterator<Container, LhsIsConst> const& lhs, IndexIterator<Container, RhsIsConst> const& rhs)
+    -> std::strong_ordering
 {
-    return lhs.index() >= rhs.index();
+    return lhs.index() <=> rhs.index();
 }
 
-template<typename Container, bool IsConst>
-auto operator-(IndexIterator<Container, IsConst> const& lhs, IndexIterator<Container, IsConst> const& rhs) ->
-    typename IndexIterator<Container, IsConst>::difference_type
+template<typename Container, bool LhsIsConst, bool RhsIsConst>
+auto operator-(IndexIterator<Container, LhsIsConst> const& lhs, IndexIterator<Container, RhsIsConst> const& rhs)
+    -> std::ptrdiff_t
 {
-    return lhs.index() - rhs.index();
+    return static_cast<std::ptrdiff_t>(lhs.index()) - static_cast<std::ptrdiff_t>(rhs.index());
 }
 
 template<typename Container, bool IsConst>
 auto operator-(IndexIterator<Container, IsConst> it, typename IndexIterator<Container, IsConst>::difference_type n)
     -> IndexIterator<Container, IsConst>
 {
-    return {it.container(), it.index() - signCast<typename IndexIterator<Container, IsConst>::index_type>(n)};
+    it -= n;
+    return it;
 }
 
 template<typename Container, bool IsConst>
 auto operator+(IndexIterator<Container, IsConst> it, typename IndexIterator<Container, IsConst>::difference_type n)
     -> IndexIterator<Container, IsConst>
 {
-    return {it.container(), it.index() + signCast<typename IndexIterator<Container, IsConst>::index_type>(n)};
-}
-
-template<typename Container, bool IsConst>
-auto operator-=(IndexIterator<Container, IsConst>& it, typename IndexIterator<Container, IsConst>::difference_type n)
-    -> IndexIterator<Container, IsConst>&
-{
-    auto tmp = it - n;
-    it       = tmp;
+    it += n;
     return it;
 }
 
 template<typename Container, bool IsConst>
-auto operator+=(IndexIterator<Container, IsConst>& it, typename IndexIterator<Container, IsConst>::difference_type n)
-    -> IndexIterator<Container, IsConst>&
+auto operator+(typename IndexIterator<Container, IsConst>::difference_type n, IndexIterator<Container, IsConst> it)
+    -> IndexIterator<Container, IsConst>
 {
-    auto tmp = it + n;
-    it       = tmp;
+    it += n;
     return it;
 }
 
@@ -26,4 +26,78 @@ TEMPLATE_TEST_CASE("core/iterator: IndexIterator", "[core][iterator]", short, un
     REQUIRE(it.container() == &c);
     REQUIRE(it.index() == 3U);
     REQUIRE(*it == T{3});
+}
+
+TEMPLATE_TEST_CASE("core/iterator: IndexIterator random access", "[core][iterator]", int, float, double)
+{
+    using T             = TestType;
+    using Container     = lt::CircularBuffer<T>;
+    using Iterator      = typename Container::iterator;
+    using ConstIterator = typename Container::const_iterator;
+
+    STATIC_REQUIRE(std::random_access_iterator<Iterator>);
+    STATIC_REQUIRE(std::random_access_iterator<ConstIterator>);
+    STATIC_REQUIRE(std::ranges::random_access_range<Container>);
+    STATIC_REQUIRE(std::ranges::sized_range<Container>);
+    STATIC_REQUIRE(std::is_convertible_v<Iterator, ConstIterator>);
+
+    auto cb = Container{5U, T{}};
+    for (auto i{1}; i <= 7; ++i) { cb.push_back(static_cast<T>(i)); }
+
+    auto const first = std::begin(cb);
+    auto const last  = std::end(cb);
+
+    REQUIRE(std::distance(first, last) == 5);
+    REQUIRE(std::distance(last, first) == -5);
+    REQUIRE(last - first == 5);
+    REQUIRE(*std::next(first, 3) == T{6});
+    REQUIRE(*std::prev(last, 2) == T{6});
+    REQUIRE(*(2 + first) == T{5});
+    REQUIRE(first[4] == T{7});
+    REQUIRE(std::next(first, 4)[-2] == T{5});
+
+    auto it = last;
+    it -= 5;
+    REQUIRE(it == first);
+    it += -1;
+    it += 1;
+    REQUIRE(it == first);
+
+    REQUIRE(first < last);
+    REQUIRE(last > first);
+    REQUIRE(first <= first);
+    REQUIRE((first <=> last) == std::strong_ordering::less);
+
+    auto const cfirst = ConstIterator{first};
+    REQUIRE(*cfirst == T{3});
+
+    // Mutable and const iterators compare and subtract with each other.
+    STATIC_REQUIRE(std::sized_sentinel_for<ConstIterator, Iterator>);
+    STATIC_REQUIRE(std::totally_ordered_with<Iterator, ConstIterator>);
+    REQUIRE(first == cfirst);
+    REQUIRE(cfirst == first);
+    REQUIRE(std::begin(cb) != std::cend(cb));
+    REQUIRE(std::cend(cb) - std::begin(cb) == 5);
+    REQUIRE(first - std::cend(cb) == -5);
+    REQUIRE(first < std::cend(cb));
+    REQUIRE((std::cend(cb) <=> first) == std::strong_ordering::greater);
+
+    SECTION("std algorithms")
+    {
+        std::reverse(std::begin(cb), std::end(cb));
+        REQUIRE(cb[0] == T{7});
+        REQUIRE(cb[4] == T{3});
+
+        std::sort(std::begin(cb), std::end(cb));
+        REQUIRE(std::is_sorted(std::cbegin(cb), std::cend(cb)));
+        REQUIRE(*std::lower_bound(std::cbegin(cb), std::cend(cb), T{5}) == T{5});
+    }
+
+    SECTION("ranges algorithms")
+    {
+        std::ranges::sort(cb, std::greater<>{});
+        REQUIRE(cb[0] == T{7});
+        REQUIRE(std::ranges::is_sorted(cb, std::greater<>{}));
+        REQUIRE(*std::ranges::max_element(cb) == T{7});
+    }
 }
\ No newline at end of file
@@ -1 +1,3 @@
-#include "lt_core/lt_core.hpp"
\ No newline at end of file
+#include "lt_core/lt_core.hpp"
+
+#include "container/MirroredCircularBuffer.cpp"
\ No newline at end of file
@@ -34,5 +34,12 @@
 #include "types/Cast.hpp"
 #include "iterator/IndexIterator.hpp"
 #include "container/Span.hpp"
+#include "container/RingSegments.hpp"
 #include "container/CircularBuffer.hpp"
+#include "container/StaticCircularBuffer.hpp"
+#include "container/MirroredCircularBuffer.hpp"
+#include "container/SpscRingBuffer.hpp"
+#include "math/SlidingWindow.hpp"
+#include "thread/BackgroundPool.hpp"
+#include "thread/ForkJoinPool.hpp"
 // clang-format on
\ No newline at end of file
@@ -0,0 +1,58 @@
+#include "lt_core/lt_core.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+static constexpr auto benchmarkBlockSize = 512U;
+
+static auto makeBlock() -> std::vector<float>
+{
+    auto rng   = std::default_random_engine{};
+    auto dist  = std::uniform_real_distribution<float>{-1.0F, 1.0F};
+    auto block = std::vector<float>(benchmarkBlockSize);
+    std::generate(std::begin(block), std::end(block), [&] { return dist(rng); });
+    return block;
+}
+
+// Writes the block to a window and scans all of it for max and rms.
+static void lt_SlidingWindow_Rescan(benchmark::State& state)
+{
+    auto const windowSize = static_cast<std::uint32_t>(state.range(0));
+    auto window           = lt::CircularBuffer<float>{windowSize};
+    auto const block      = makeBlock();
+
+    for (auto _ : state)
+    {
+        window.write(lt::Span<float const>{block});
+        auto const segments = std::as_const(window).segments();
+        auto const squares  = lt::accumulateSegments(segments, 0.0F, [](auto sum, auto x) { return sum + x * x; });
+        auto const max      = lt::accumulateSegments(segments, 0.0F, [](auto m, auto x) { return std::max(m, x); });
+        benchmark::DoNotOptimize(std::sqrt(squares / static_cast<float>(windowSize)));
+        benchmark::DoNotOptimize(max);
+    }
+
+    state.SetItemsProcessed(state.iterations() * benchmarkBlockSize);
+}
+BENCHMARK(lt_SlidingWindow_Rescan)->Arg(4800)->Arg(48000);
+
+// Per sample max and rms of the window, for every sample of the block.
+static void lt_SlidingWindow_Sliding(benchmark::State& state)
+{
+    auto const windowSize = static_cast<std::uint32_t>(state.range(0));
+    auto rms              = lt::SlidingRms<float>{windowSize};
+    auto max              = lt::SlidingMax<float>{windowSize};
+    auto const block      = makeBlock();
+    auto output           = std::vector<float>(benchmarkBlockSize);
+
+    for (auto _ : state)
+    {
+        rms.process(lt::Span<float const>{block}, lt::Span<float>{output});
+        benchmark::DoNotOptimize(output.data());
+        max.process(lt::Span<float const>{block}, lt::Span<float>{output});
+        benchmark::DoNotOptimize(output.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * benchmarkBlockSize);
+}
+BENCHMARK(lt_SlidingWindow_Sliding)->Arg(4800)->Arg(48000);
\ No newline at end of file
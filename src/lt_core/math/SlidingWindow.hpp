@@ -0,0 +1,339 @@
+#pragma once
+
+namespace lt
+{
+
+/// \brief Sum of the last windowSize() values, O(1) per sample.
+///
+/// \details The values are kept in a CircularBuffer window, which starts
+/// out filled with zeros. Every new value adds the difference to the
+/// value that leaves the window to a Kahan compensated running sum.
+/// Once per window length the sum is recomputed from the window, so
+/// rounding errors never build up over time. That costs one pass over
+/// the window every windowSize() samples, which is still O(1) per
+/// sample.
+///
+/// process() computes the differences for a whole chunk in one loop
+/// the compiler vectorizes, only the running sum itself is serial.
+template<typename T>
+struct SlidingSum
+{
+    using value_type = T;
+    using size_type  = std::uint32_t;
+
+    explicit SlidingSum(size_type windowSize);
+
+    [[nodiscard]] auto windowSize() const noexcept -> size_type;
+    [[nodiscard]] auto window() const noexcept -> CircularBuffer<value_type> const&;
+    [[nodiscard]] auto sum() const noexcept -> value_type;
+    [[nodiscard]] auto mean() const noexcept -> value_type;
+
+    /// \brief Adds a value and returns the sum of the window.
+    auto push(value_type value) -> value_type;
+
+    /// \brief output[i] is the sum after input[i] was pushed, output may alias input.
+    auto process(Span<value_type const> input, Span<value_type> output) -> void;
+
+    /// \brief Recomputes the sum from the window.
+    auto refresh() -> void;
+    auto reset() -> void;
+
+private:
+    static constexpr auto chunkSize = 64U;
+
+    auto accumulate(value_type delta) noexcept -> void;
+
+    CircularBuffer<value_type> _window;
+    value_type _sum{};
+    value_type _compensation{};
+    size_type _sinceRefresh{0};
+};
+
+/// \brief Root mean square of the last windowSize() values, O(1) per sample.
+///
+/// \details A SlidingSum of the squared values.
+template<typename T>
+struct SlidingRms
+{
+    using value_type = T;
+    using size_type  = std::uint32_t;
+
+    explicit SlidingRms(size_type windowSize);
+
+    [[nodiscard]] auto windowSize() const noexcept -> size_type;
+    [[nodiscard]] auto value() const noexcept -> value_type;
+
+    /// \brief Adds a value and returns the rms of the window.
+    auto push(value_type value) -> value_type;
+
+    /// \brief output[i] is the rms after input[i] was pushed, output may alias input.
+    auto process(Span<value_type const> input, Span<value_type> output) -> void;
+    auto reset() -> void;
+
+private:
+    [[nodiscard]] auto rms(value_type sumOfSquares) const noexcept -> value_type;
+
+    SlidingSum<value_type> _squares;
+};
+
+/// \brief Extremum of the last windowSize() values, O(1) amortized per sample.
+///
+/// \details Monotonic deque: it holds the values that can still become
+/// the extremum, each with the time it was pushed, ordered by Compare
+/// from the front. A new value removes every value at the back that it
+/// beats or ties, the front leaves once it is older than the window.
+/// Every value enters and leaves the deque once. The deque lives in
+/// power of two storage allocated up front, push() never allocates.
+///
+/// Like SlidingSum the window starts out filled with zeros.
+template<typename T, typename Compare>
+struct SlidingExtremum
+{
+    using value_type = T;
+    using size_type  = std::uint32_t;
+
+    explicit SlidingExtremum(size_type windowSize);
+
+    [[nodiscard]] auto windowSize() const noexcept -> size_type;
+    [[nodiscard]] auto value() const noexcept -> value_type;
+
+    /// \brief Adds a value and returns the extremum of the window.
+    auto push(value_type value) -> value_type;
+
+    /// \brief output[i] is the extremum after input[i] was pushed, output may alias input.
+    auto process(Span<value_type const> input, Span<value_type> output) -> void;
+    auto reset() -> void;
+
+private:
+    std::vector<value_type> _values;
+    std::vector<size_type> _times;
+    size_type _windowSize;
+    size_type _mask;
+    size_type _head{0};
+    size_type _count{0};
+    size_type _time{0};
+};
+
+/// \brief Maximum of the last windowSize() values.
+template<typename T>
+using SlidingMax = SlidingExtremum<T, std::greater<>>;
+
+/// \brief Minimum of the last windowSize() values.
+template<typename T>
+using SlidingMin = SlidingExtremum<T, std::less<>>;
+
+template<typename T>
+SlidingSum<T>::SlidingSum(size_type windowSize) : _window{windowSize}
+{
+    jassert(windowSize > 0U);
+}
+
+template<typename T>
+auto SlidingSum<T>::windowSize() const noexcept -> size_type
+{
+    return _window.size();
+}
+
+template<typename T>
+auto SlidingSum<T>::window() const noexcept -> CircularBuffer<value_type> const&
+{
+    return _window;
+}
+
+template<typename T>
+auto SlidingSum<T>::sum() const noexcept -> value_type
+{
+    return _sum;
+}
+
+template<typename T>
+auto SlidingSum<T>::mean() const noexcept -> value_type
+{
+    return _sum / static_cast<value_type>(windowSize());
+}
+
+template<typename T>
+auto SlidingSum<T>::push(value_type value) -> value_type
+{
+    auto const oldest = _window[0];
+    _window.push_back(value);
+    accumulate(value - oldest);
+
+    if (++_sinceRefresh >= windowSize()) { refresh(); }
+    return _sum;
+}
+
+template<typename T>
+auto SlidingSum<T>::process(Span<value_type const> input, Span<value_type> output) -> void
+{
+    jassert(std::size(output) == std::size(input));
+
+    auto const maxChunk = std::min(chunkSize, windowSize());
+    auto deltas         = std::array<value_type, chunkSize>{};
+
+    for (auto start = std::size_t{0}; start < std::size(input);)
+    {
+        auto const count = std::min<std::size_t>(maxChunk, std::size(input) - start);
+        auto const in    = input.subspan(start, count);
+        auto const delta = Span<value_type>{deltas}.first(count);
+
+        // The oldest count values leave the window as the chunk enters.
+        _window.peek(delta);
+        _window.write(in);
+        std::transform(std::begin(in), std::end(in), std::begin(delta), std::begin(delta), std::minus<>{});
+
+        auto* const out = std::next(std::data(output), static_cast<std::ptrdiff_t>(start));
+        for (auto i = std::size_t{0}; i < count; ++i)
+        {
+            accumulate(delta[i]);
+            out[i] = _sum;
+        }
+
+        _sinceRefresh += narrowCast<size_type>(count);
+        if (_sinceRefresh >= windowSize()) { refresh(); }
+        start += count;
+    }
+}
+
+template<typename T>
+auto SlidingSum<T>::refresh() -> void
+{
+    _sum          = accumulateSegments(_window.segments(), value_type{});
+    _compensation = value_type{};
+    _sinceRefresh = 0;
+}
+
+template<typename T>
+auto SlidingSum<T>::reset() -> void
+{
+    _window.resize(windowSize(), ResizeMode::clear);
+    _sum          = value_type{};
+    _compensation = value_type{};
+    _sinceRefresh = 0;
+}
+
+template<typename T>
+auto SlidingSum<T>::accumulate(value_type delta) noexcept -> void
+{
+    // Kahan summation, the compensation holds the low order bits lost
+    // in the previous addition.
+    auto const y  = delta - _compensation;
+    auto const t  = _sum + y;
+    _compensation = (t - _sum) - y;
+    _sum          = t;
+}
+
+template<typename T>
+SlidingRms<T>::SlidingRms(size_type windowSize) : _squares{windowSize}
+{
+}
+
+template<typename T>
+auto SlidingRms<T>::windowSize() const noexcept -> size_type
+{
+    return _squares.windowSize();
+}
+
+template<typename T>
+auto SlidingRms<T>::value() const noexcept -> value_type
+{
+    return rms(_squares.sum());
+}
+
+template<typename T>
+auto SlidingRms<T>::push(value_type value) -> value_type
+{
+    return rms(_squares.push(value * value));
+}
+
+template<typename T>
+auto SlidingRms<T>::process(Span<value_type const> input, Span<value_type> output) -> void
+{
+    jassert(std::size(output) == std::size(input));
+
+    std::transform(std::begin(input), std::end(input), std::begin(output), [](auto x) { return x * x; });
+    _squares.process(output, output);
+    std::transform(std::begin(output), std::end(output), std::begin(output), [this](auto s) { return rms(s); });
+}
+
+template<typename T>
+auto SlidingRms<T>::reset() -> void
+{
+    _squares.reset();
+}
+
+template<typename T>
+auto SlidingRms<T>::rms(value_type sumOfSquares) const noexcept -> value_type
+{
+    // The running sum can dip just below zero after loud passages.
+    auto const meanSquare = sumOfSquares / static_cast<value_type>(windowSize());
+    return std::sqrt(meanSquare > value_type{} ? meanSquare : value_type{});
+}
+
+template<typename T, typename Compare>
+SlidingExtremum<T, Compare>::SlidingExtremum(size_type windowSize)
+    : _values(std::bit_ceil(windowSize))
+    , _times(std::bit_ceil(windowSize))
+    , _windowSize{windowSize}
+    , _mask{std::bit_ceil(windowSize) - 1U}
+{
+    jassert(windowSize > 0U);
+    reset();
+}
+
+template<typename T, typename Compare>
+auto SlidingExtremum<T, Compare>::windowSize() const noexcept -> size_type
+{
+    return _windowSize;
+}
+
+template<typename T, typename Compare>
+auto SlidingExtremum<T, Compare>::value() const noexcept -> value_type
+{
+    return _values[_head];
+}
+
+template<typename T, typename Compare>
+auto SlidingExtremum<T, Compare>::push(value_type value) -> value_type
+{
+    // Times increase by one per push, at most the front expires. Expiring
+    // it first keeps at most windowSize values in the deque.
+    if (_count > 0U && _time - _times[_head] >= _windowSize)
+    {
+        _head = (_head + 1U) & _mask;
+        --_count;
+    }
+
+    // Values the new one beats or ties can never be the extremum again.
+    auto const compare = Compare{};
+    while (_count > 0U && !compare(_values[(_head + _count - 1U) & _mask], value)) { --_count; }
+
+    auto const back = (_head + _count) & _mask;
+    _values[back]   = value;
+    _times[back]    = _time;
+    ++_count;
+
+    ++_time;
+    return _values[_head];
+}
+
+template<typename T, typename Compare>
+auto SlidingExtremum<T, Compare>::process(Span<value_type const> input, Span<value_type> output) -> void
+{
+    jassert(std::size(output) == std::size(input));
+    std::transform(std::begin(input), std::end(input), std::begin(output), [this](auto x) { return push(x); });
+}
+
+template<typename T, typename Compare>
+auto SlidingExtremum<T, Compare>::reset() -> void
+{
+    // One zero pushed just before time zero stands for a window full of
+    // zeros, ties keep only the newest value anyway.
+    _time      = 0;
+    _head      = 0;
+    _count     = 1;
+    _values[0] = value_type{};
+    _times[0]  = _time - 1U;
+}
+
+}  // namespace lt
\ No newline at end of file
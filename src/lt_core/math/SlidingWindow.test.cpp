@@ -0,0 +1,145 @@
+#include <lt_core/lt_core.hpp>
+
+#include "catch2/catch_approx.hpp"
+#include "catch2/catch_template_test_macros.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+#include <random>
+
+namespace
+{
+
+template<typename T>
+auto randomSignal(std::size_t size) -> std::vector<T>
+{
+    auto rng    = std::mt19937{42};
+    auto dist   = std::uniform_real_distribution<T>{T(-1), T(1)};
+    auto signal = std::vector<T>(size);
+    std::generate(std::begin(signal), std::end(signal), [&] { return dist(rng); });
+    return signal;
+}
+
+// The window over the zeros before the signal and the signal up to index i.
+template<typename T, typename Func>
+auto bruteForce(std::vector<T> const& signal, std::size_t i, std::size_t windowSize, Func func) -> T
+{
+    auto window = std::vector<T>(windowSize);
+    for (auto k = std::size_t{0}; k < windowSize; ++k)
+    {
+        auto const age = windowSize - 1U - k;
+        window[k]      = i >= age ? signal[i - age] : T{};
+    }
+    return func(window);
+}
+
+}  // namespace
+
+TEMPLATE_TEST_CASE("core/math: SlidingWindow", "[core][math]", float, double)
+{
+    using T = TestType;
+
+    auto const signal = randomSignal<T>(2000U);
+
+    for (auto const windowSize : {1U, 7U, 64U, 100U})
+    {
+        auto const sumOf = [](auto const& w) { return std::accumulate(std::begin(w), std::end(w), T{}); };
+        auto const maxOf = [](auto const& w) { return *std::max_element(std::begin(w), std::end(w)); };
+        auto const minOf = [](auto const& w) { return *std::min_element(std::begin(w), std::end(w)); };
+        auto const rmsOf = [&](auto const& w) {
+            auto const squares = std::inner_product(std::begin(w), std::end(w), std::begin(w), T{});
+            return std::sqrt(squares / static_cast<T>(std::size(w)));
+        };
+
+        SECTION("push matches brute force, window " + std::to_string(windowSize))
+        {
+            auto sum = lt::SlidingSum<T>{windowSize};
+            auto rms = lt::SlidingRms<T>{windowSize};
+            auto max = lt::SlidingMax<T>{windowSize};
+            auto min = lt::SlidingMin<T>{windowSize};
+            REQUIRE(sum.windowSize() == windowSize);
+            REQUIRE(max.value() == T{});
+
+            for (auto i = std::size_t{0}; i < std::size(signal); ++i)
+            {
+                REQUIRE(sum.push(signal[i]) == Catch::Approx(bruteForce(signal, i, windowSize, sumOf)).margin(1e-4));
+                REQUIRE(rms.push(signal[i]) == Catch::Approx(bruteForce(signal, i, windowSize, rmsOf)).margin(1e-4));
+                REQUIRE(max.push(signal[i]) == bruteForce(signal, i, windowSize, maxOf));
+                REQUIRE(min.push(signal[i]) == bruteForce(signal, i, windowSize, minOf));
+            }
+
+            REQUIRE(sum.mean() == Catch::Approx(sum.sum() / static_cast<T>(windowSize)));
+        }
+
+        SECTION("process matches push, window " + std::to_string(windowSize))
+        {
+            auto check = [&](auto blockProcessor, auto sampleProcessor) {
+                auto output = std::vector<T>(std::size(signal));
+                for (auto start = std::size_t{0}; start < std::size(signal); start += 93U)
+                {
+                    auto const count = std::min<std::size_t>(93U, std::size(signal) - start);
+                    blockProcessor.process(lt::Span<T const>{signal}.subspan(start, count),
+                                           lt::Span<T>{output}.subspan(start, count));
+                }
+
+                for (auto i = std::size_t{0}; i < std::size(signal); ++i)
+                {
+                    REQUIRE(output[i] == Catch::Approx(sampleProcessor.push(signal[i])).margin(1e-5));
+                }
+            };
+
+            check(lt::SlidingSum<T>{windowSize}, lt::SlidingSum<T>{windowSize});
+            check(lt::SlidingRms<T>{windowSize}, lt::SlidingRms<T>{windowSize});
+            check(lt::SlidingMax<T>{windowSize}, lt::SlidingMax<T>{windowSize});
+            check(lt::SlidingMin<T>{windowSize}, lt::SlidingMin<T>{windowSize});
+        }
+    }
+
+    SECTION("monotone signals fill the window")
+    {
+        // Every value stays in the deque until it expires, the storage has
+        // to hold a full window.
+        for (auto const windowSize : {4U, 64U})
+        {
+            auto max = lt::SlidingMax<T>{windowSize};
+            auto min = lt::SlidingMin<T>{windowSize};
+            for (auto i = 0U; i < 4U * windowSize; ++i)
+            {
+                auto const first   = i + 1U >= windowSize ? i + 1U - windowSize : 0U;
+                auto const falling = static_cast<T>(4U * windowSize - i);
+                auto const oldest  = static_cast<T>(4U * windowSize - first);
+                REQUIRE(max.push(falling) == oldest);
+                REQUIRE(min.push(-falling) == -oldest);
+            }
+        }
+    }
+
+    SECTION("sum does not drift")
+    {
+        // A loud passage followed by silence, the sum has to get back to zero.
+        auto sum = lt::SlidingSum<T>{1000U};
+        for (auto const sample : signal) { sum.push(sample * T(1000)); }
+        for (auto i{0U}; i < 1000U; ++i) { sum.push(T{}); }
+        REQUIRE(sum.sum() == T{});
+
+        auto rms = lt::SlidingRms<T>{1000U};
+        for (auto const sample : signal) { rms.push(sample * T(1000)); }
+        for (auto i{0U}; i < 1000U; ++i) { rms.push(T{}); }
+        REQUIRE(rms.value() == T{});
+    }
+
+    SECTION("reset")
+    {
+        auto sum = lt::SlidingSum<T>{16U};
+        auto max = lt::SlidingMax<T>{16U};
+        for (auto const sample : signal) { sum.push(sample); }
+        for (auto const sample : signal) { max.push(sample); }
+
+        sum.reset();
+        max.reset();
+        REQUIRE(sum.sum() == T{});
+        REQUIRE(max.value() == T{});
+        REQUIRE(std::all_of(std::cbegin(sum.window()), std::cend(sum.window()), [](auto v) { return v == T{}; }));
+        REQUIRE(sum.push(T(2)) == T(2));
+        REQUIRE(max.push(T(-2)) == T{});
+    }
+}
\ No newline at end of file
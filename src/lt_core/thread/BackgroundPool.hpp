@@ -0,0 +1,270 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <latch>
+#include <mutex>
+#include <semaphore>
+#include <thread>
+
+namespace lt
+{
+
+/// \brief Fixed set of realtime worker threads for jobs that are started
+/// in one audio callback and only needed in a later one.
+///
+/// \details The audio thread queues a Job with submit() and collects it
+/// with wait(). Idle workers take the queued job with the earliest
+/// deadline first, so short jobs that are due soon overtake long ones
+/// that were queued before them. Neither submit() nor wait() locks or
+/// allocates.
+///
+/// The deadline only orders the jobs, nothing is cancelled. A job that
+/// is not finished by the time it is waited for blocks the audio thread
+/// until it is. This happens when the due work of all users exceeds what
+/// the workers can do in time. If every queue slot is taken, submit()
+/// runs the job on the calling thread instead.
+///
+/// Workers are started as realtime threads. If the system refuses
+/// realtime scheduling, they fall back to the highest normal priority.
+struct BackgroundPool
+{
+    using Clock = std::chrono::steady_clock;
+
+    /// \brief Work that is queued at most once at a time.
+    struct Job
+    {
+        using Invoke = void (*)(void*);
+
+        Job(Invoke invoke, void* context) noexcept;
+
+        Job(Job const& other)                    = delete;
+        auto operator=(Job const& other) -> Job& = delete;
+
+        /// \brief True between submit() and the matching wait().
+        [[nodiscard]] auto isPending() const noexcept -> bool;
+
+    private:
+        friend BackgroundPool;
+
+        Invoke _invoke;
+        void* _context;
+        std::atomic<Clock::rep> _deadline{0};
+        std::binary_semaphore _done{0};
+        bool _pending{false};
+    };
+
+    explicit BackgroundPool(std::uint32_t numWorkers, std::uint32_t maxQueuedJobs = 64U,
+                            juce::Thread::RealtimeOptions const& options = {});
+    ~BackgroundPool();
+
+    BackgroundPool(BackgroundPool const& other)                    = delete;
+    auto operator=(BackgroundPool const& other) -> BackgroundPool& = delete;
+
+    /// \brief Pool for all users that do not bring their own, created on
+    /// first use with one worker less than there are cores.
+    [[nodiscard]] static auto shared() -> std::shared_ptr<BackgroundPool>;
+
+    /// \brief Queues the job, it must not be pending.
+    auto submit(Job& job, Clock::time_point deadline) -> void;
+
+    /// \brief Returns once the job has finished, immediately if it is not pending.
+    auto wait(Job& job) -> void;
+
+    /// \brief Calls function() exactly once on every worker, for per-thread
+    /// setup such as reserving work memory, and returns once all calls have
+    /// finished. The calls overtake every queued job, but each worker
+    /// finishes its current one first. Concurrent calls run one after the
+    /// other. Blocks, must not be called from the audio thread.
+    template<typename Function>
+    auto runOnEachWorker(Function&& function) -> void;
+
+    [[nodiscard]] auto numWorkers() const noexcept -> std::uint32_t;
+
+private:
+    struct Worker final : juce::Thread
+    {
+        explicit Worker(BackgroundPool& owner);
+        auto run() -> void override;
+
+        BackgroundPool& pool;
+    };
+
+    auto enqueue(Job& job) -> bool;
+    auto workerLoop() -> void;
+    auto claim() -> Job*;
+
+    std::vector<std::unique_ptr<Worker>> _workers{};
+    std::vector<std::atomic<Job*>> _queue;
+    std::counting_semaphore<> _queued{0};
+    std::atomic<bool> _exit{false};
+    std::mutex _runOnEachWorkerMutex{};
+};
+
+inline BackgroundPool::Job::Job(Invoke invoke, void* context) noexcept : _invoke{invoke}, _context{context}
+{
+}
+
+inline auto BackgroundPool::Job::isPending() const noexcept -> bool
+{
+    return _pending;
+}
+
+inline BackgroundPool::Worker::Worker(BackgroundPool& owner) : juce::Thread{"lt::BackgroundPool"}, pool{owner}
+{
+}
+
+inline auto BackgroundPool::Worker::run() -> void
+{
+    pool.workerLoop();
+}
+
+inline BackgroundPool::BackgroundPool(std::uint32_t numWorkers, std::uint32_t maxQueuedJobs,
+                                      juce::Thread::RealtimeOptions const& options)
+    : _queue(maxQueuedJobs)
+{
+    jassert(maxQueuedJobs > 0U);
+
+    _workers.reserve(numWorkers);
+    for (auto i{0U}; i < numWorkers; ++i) { _workers.push_back(std::make_unique<Worker>(*this)); }
+    for (auto& worker : _workers)
+    {
+        if (!worker->startRealtimeThread(options)) { worker->startThread(juce::Thread::Priority::highest); }
+    }
+}
+
+inline BackgroundPool::~BackgroundPool()
+{
+    _exit.store(true);
+    _queued.release(signCast<std::ptrdiff_t>(std::size(_workers)));
+    for (auto& worker : _workers) { worker->waitForThreadToExit(-1); }
+}
+
+inline auto BackgroundPool::shared() -> std::shared_ptr<BackgroundPool>
+{
+    static auto mutex = std::mutex{};
+    static auto pool  = std::weak_ptr<BackgroundPool>{};
+
+    auto const lock = std::scoped_lock{mutex};
+    if (auto existing = pool.lock()) { return existing; }
+
+    auto const cores = std::thread::hardware_concurrency();
+    auto created     = std::make_shared<BackgroundPool>(cores > 1U ? cores - 1U : 1U);
+    pool             = created;
+    return created;
+}
+
+inline auto BackgroundPool::submit(Job& job, Clock::time_point deadline) -> void
+{
+    jassert(!job._pending);
+    job._deadline.store(deadline.time_since_epoch().count(), std::memory_order_relaxed);
+    if (enqueue(job)) { return; }
+
+    // No free slot, workers would not get to it in time anyway.
+    job._invoke(job._context);
+}
+
+inline auto BackgroundPool::wait(Job& job) -> void
+{
+    if (!job._pending) { return; }
+    job._done.acquire();
+    job._pending = false;
+}
+
+template<typename Function>
+auto BackgroundPool::runOnEachWorker(Function&& function) -> void
+{
+    // The latch only completes if no other call's jobs are queued alongside.
+    auto const lock = std::scoped_lock{_runOnEachWorkerMutex};
+
+    auto started = std::latch{signCast<std::ptrdiff_t>(numWorkers())};
+    auto call    = [&] {
+        function();
+        // No worker takes a second of these jobs before every worker has one.
+        started.arrive_and_wait();
+    };
+    using Call = decltype(call);
+
+    auto jobs = std::vector<std::unique_ptr<Job>>{};
+    jobs.reserve(numWorkers());
+    for (auto i{0U}; i < numWorkers(); ++i)
+    {
+        jobs.push_back(std::make_unique<Job>([](void* context) { (*static_cast<Call*>(context))(); }, &call));
+    }
+
+    // Running one inline would leave a worker out, wait for a free slot instead.
+    for (auto& job : jobs)
+    {
+        job->_deadline.store(Clock::time_point::min().time_since_epoch().count(), std::memory_order_relaxed);
+        while (!enqueue(*job)) { std::this_thread::yield(); }
+    }
+
+    for (auto& job : jobs) { wait(*job); }
+}
+
+inline auto BackgroundPool::numWorkers() const noexcept -> std::uint32_t
+{
+    return narrowCast<std::uint32_t>(std::size(_workers));
+}
+
+inline auto BackgroundPool::enqueue(Job& job) -> bool
+{
+    for (auto& slot : _queue)
+    {
+        auto* expected = static_cast<Job*>(nullptr);
+        if (slot.compare_exchange_strong(expected, &job, std::memory_order_acq_rel))
+        {
+            job._pending = true;
+            _queued.release();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+inline auto BackgroundPool::workerLoop() -> void
+{
+    while (true)
+    {
+        _queued.acquire();
+        if (_exit.load()) { return; }
+
+        auto* const job = claim();
+        job->_invoke(job->_context);
+        job->_done.release();
+    }
+}
+
+inline auto BackgroundPool::claim() -> Job*
+{
+    // Every acquired count has a job in the queue that no other worker
+    // has claimed yet, so the search always ends.
+    while (true)
+    {
+        auto* earliest = static_cast<Job*>(nullptr);
+        auto* slot     = static_cast<std::atomic<Job*>*>(nullptr);
+        auto deadline  = Clock::rep{};
+
+        for (auto& candidate : _queue)
+        {
+            auto* const job = candidate.load(std::memory_order_acquire);
+            if (job == nullptr) { continue; }
+
+            auto const due = job->_deadline.load(std::memory_order_relaxed);
+            if (earliest == nullptr || due < deadline)
+            {
+                earliest = job;
+                slot     = &candidate;
+                deadline = due;
+            }
+        }
+
+        if (earliest != nullptr && slot->compare_exchange_strong(earliest, nullptr, std::memory_order_acq_rel))
+        {
+            return earliest;
+        }
+    }
+}
+
+}  // namespace lt
\ No newline at end of file
@@ -0,0 +1,154 @@
+#include <lt_core/lt_core.hpp>
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <mutex>
+#include <set>
+#include <thread>
+
+namespace
+{
+struct Counter
+{
+    static auto invoke(void* context) -> void { static_cast<Counter*>(context)->calls++; }
+
+    std::atomic<int> calls{0};
+};
+}  // namespace
+
+TEST_CASE("core/thread: BackgroundPool", "[core][thread]")
+{
+    using Clock = lt::BackgroundPool::Clock;
+
+    SECTION("jobs run once per submit")
+    {
+        auto const numWorkers = GENERATE(1U, 3U);
+        auto pool             = lt::BackgroundPool{numWorkers};
+        REQUIRE(pool.numWorkers() == numWorkers);
+
+        auto counters = std::vector<Counter>(5U);
+        auto jobs     = std::vector<std::unique_ptr<lt::BackgroundPool::Job>>{};
+        for (auto& counter : counters)
+        {
+            jobs.push_back(std::make_unique<lt::BackgroundPool::Job>(&Counter::invoke, &counter));
+        }
+
+        for (auto round{0}; round < 200; ++round)
+        {
+            for (auto& job : jobs) { pool.submit(*job, Clock::now() + std::chrono::milliseconds{round % 7}); }
+            for (auto& job : jobs)
+            {
+                REQUIRE(job->isPending());
+                pool.wait(*job);
+                REQUIRE_FALSE(job->isPending());
+            }
+        }
+
+        for (auto const& counter : counters) { REQUIRE(counter.calls.load() == 200); }
+    }
+
+    SECTION("earliest deadline first")
+    {
+        // One worker blocked by the first job, the others queue up behind it.
+        auto pool    = lt::BackgroundPool{1U};
+        auto started = std::binary_semaphore{0};
+        auto release = std::binary_semaphore{0};
+        auto order   = std::vector<int>{};
+
+        struct Recorder
+        {
+            static auto invoke(void* context) -> void
+            {
+                auto* self = static_cast<Recorder*>(context);
+                if (self->gate != nullptr)
+                {
+                    self->started->release();
+                    self->gate->acquire();
+                }
+                self->order->push_back(self->id);
+            }
+
+            int id;
+            std::vector<int>* order;
+            std::binary_semaphore* started;
+            std::binary_semaphore* gate;
+        };
+
+        auto blocker = Recorder{0, &order, &started, &release};
+        auto late    = Recorder{1, &order, nullptr, nullptr};
+        auto early   = Recorder{2, &order, nullptr, nullptr};
+
+        auto blockerJob = lt::BackgroundPool::Job{&Recorder::invoke, &blocker};
+        auto lateJob    = lt::BackgroundPool::Job{&Recorder::invoke, &late};
+        auto earlyJob   = lt::BackgroundPool::Job{&Recorder::invoke, &early};
+
+        auto const now = Clock::now();
+        pool.submit(blockerJob, now);
+        started.acquire();
+
+        pool.submit(lateJob, now + std::chrono::seconds{2});
+        pool.submit(earlyJob, now + std::chrono::seconds{1});
+        release.release();
+
+        pool.wait(blockerJob);
+        pool.wait(lateJob);
+        pool.wait(earlyJob);
+        REQUIRE(order == std::vector<int>{0, 2, 1});
+    }
+
+    SECTION("full queue runs inline")
+    {
+        auto pool      = lt::BackgroundPool{0U, 1U};
+        auto first     = Counter{};
+        auto second    = Counter{};
+        auto firstJob  = lt::BackgroundPool::Job{&Counter::invoke, &first};
+        auto secondJob = lt::BackgroundPool::Job{&Counter::invoke, &second};
+
+        // Without workers the first job stays queued.
+        pool.submit(firstJob, Clock::now());
+        pool.submit(secondJob, Clock::now());
+        REQUIRE(firstJob.isPending());
+        REQUIRE_FALSE(secondJob.isPending());
+        REQUIRE(first.calls.load() == 0);
+        REQUIRE(second.calls.load() == 1);
+    }
+
+    SECTION("runOnEachWorker")
+    {
+        auto const numWorkers = GENERATE(0U, 1U, 3U);
+        auto pool             = lt::BackgroundPool{numWorkers, 2U};
+
+        auto mutex = std::mutex{};
+        auto ids   = std::multiset<std::thread::id>{};
+        for (auto round{0}; round < 50; ++round)
+        {
+            ids.clear();
+            pool.runOnEachWorker([&] {
+                auto const lock = std::scoped_lock{mutex};
+                ids.insert(std::this_thread::get_id());
+            });
+
+            // Every worker once, none of them inline on this thread.
+            REQUIRE(ids.size() == numWorkers);
+            REQUIRE(ids.count(std::this_thread::get_id()) == 0U);
+            for (auto const& id : ids) { REQUIRE(ids.count(id) == 1U); }
+        }
+    }
+
+    SECTION("runOnEachWorker from several threads at once")
+    {
+        auto pool  = lt::BackgroundPool{4U};
+        auto calls = std::atomic<int>{0};
+
+        auto threads = std::vector<std::thread>{};
+        for (auto t{0}; t < 3; ++t)
+        {
+            threads.emplace_back([&] {
+                for (auto round{0}; round < 50; ++round) { pool.runOnEachWorker([&] { ++calls; }); }
+            });
+        }
+        for (auto& thread : threads) { thread.join(); }
+
+        REQUIRE(calls.load() == 3 * 50 * 4);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,178 @@
+#pragma once
+
+#include <atomic>
+#include <latch>
+#include <semaphore>
+
+namespace lt
+{
+
+/// \brief Fixed set of worker threads for fork/join parallelism
+/// from a realtime thread.
+///
+/// \details run() hands out task indices through an atomic counter,
+/// the calling thread works on tasks as well and then waits until every
+/// worker it woke has finished. Nothing in run() locks or allocates.
+/// Workers are woken with a semaphore each, the join spins briefly
+/// before it falls back to waiting on an atomic.
+///
+/// The caller waits for the workers inside its audio callback, so the
+/// workers are started as realtime threads with the given options. If
+/// the system refuses realtime scheduling, they fall back to the highest
+/// normal priority.
+struct ForkJoinPool
+{
+    explicit ForkJoinPool(std::uint32_t numWorkers, juce::Thread::RealtimeOptions const& options = {});
+    ~ForkJoinPool();
+
+    ForkJoinPool(ForkJoinPool const& other)                    = delete;
+    auto operator=(ForkJoinPool const& other) -> ForkJoinPool& = delete;
+
+    /// \brief Calls task(index) for every index in [0, numTasks) and
+    /// returns once all of them have finished.
+    template<typename Task>
+    auto run(std::uint32_t numTasks, Task&& task) -> void;
+
+    /// \brief Calls function() exactly once on every worker and on the
+    /// calling thread, for per-thread setup such as reserving work memory.
+    template<typename Function>
+    auto runOnEachThread(Function&& function) -> void;
+
+    [[nodiscard]] auto numWorkers() const noexcept -> std::uint32_t;
+
+private:
+    struct Worker final : juce::Thread
+    {
+        explicit Worker(ForkJoinPool& owner);
+        auto run() -> void override;
+
+        ForkJoinPool& pool;
+        std::binary_semaphore start{0};
+    };
+
+    using Invoke = void (*)(void*, std::uint32_t);
+
+    auto workerLoop(Worker& worker) -> void;
+    auto work() -> void;
+    auto join() -> void;
+
+    std::vector<std::unique_ptr<Worker>> _workers{};
+
+    Invoke _invoke{nullptr};
+    void* _task{nullptr};
+    std::uint32_t _numTasks{0};
+
+    // Claimed by every thread, kept apart to avoid false sharing.
+    alignas(64) std::atomic<std::uint32_t> _next{0};
+    alignas(64) std::atomic<std::uint32_t> _active{0};
+    std::atomic<bool> _exit{false};
+};
+
+inline ForkJoinPool::Worker::Worker(ForkJoinPool& owner) : juce::Thread{"lt::ForkJoinPool"}, pool{owner}
+{
+}
+
+inline auto ForkJoinPool::Worker::run() -> void
+{
+    pool.workerLoop(*this);
+}
+
+inline ForkJoinPool::ForkJoinPool(std::uint32_t numWorkers, juce::Thread::RealtimeOptions const& options)
+{
+    _workers.reserve(numWorkers);
+    for (auto i{0U}; i < numWorkers; ++i) { _workers.push_back(std::make_unique<Worker>(*this)); }
+    for (auto& worker : _workers)
+    {
+        if (!worker->startRealtimeThread(options)) { worker->startThread(juce::Thread::Priority::highest); }
+    }
+}
+
+inline ForkJoinPool::~ForkJoinPool()
+{
+    _exit.store(true);
+    for (auto& worker : _workers) { worker->start.release(); }
+    for (auto& worker : _workers) { worker->waitForThreadToExit(-1); }
+}
+
+template<typename Task>
+auto ForkJoinPool::run(std::uint32_t numTasks, Task&& task) -> void
+{
+    using TaskType = std::remove_reference_t<Task>;
+
+    auto const numWoken = std::min(numWorkers(), numTasks > 0U ? numTasks - 1U : 0U);
+    if (numWoken == 0U)
+    {
+        for (auto i{0U}; i < numTasks; ++i) { task(i); }
+        return;
+    }
+
+    _invoke   = [](void* context, std::uint32_t index) { (*static_cast<TaskType*>(context))(index); };
+    _task     = const_cast<void*>(static_cast<void const*>(std::addressof(task)));
+    _numTasks = numTasks;
+    _next.store(0U, std::memory_order_relaxed);
+    _active.store(numWoken, std::memory_order_relaxed);
+
+    // The semaphore release publishes the task to the worker.
+    for (auto i{0U}; i < numWoken; ++i) { _workers[i]->start.release(); }
+
+    work();
+    join();
+}
+
+template<typename Function>
+auto ForkJoinPool::runOnEachThread(Function&& function) -> void
+{
+    auto const numThreads = numWorkers() + 1U;
+    auto started          = std::latch{signCast<std::ptrdiff_t>(numThreads)};
+
+    // run() wakes every worker for this many tasks, and no thread takes a
+    // second task before all of them have taken their first.
+    run(numThreads, [&](std::uint32_t) {
+        function();
+        started.arrive_and_wait();
+    });
+}
+
+inline auto ForkJoinPool::numWorkers() const noexcept -> std::uint32_t
+{
+    return narrowCast<std::uint32_t>(std::size(_workers));
+}
+
+inline auto ForkJoinPool::workerLoop(Worker& worker) -> void
+{
+    while (true)
+    {
+        worker.start.acquire();
+        if (_exit.load()) { return; }
+
+        work();
+        if (_active.fetch_sub(1U, std::memory_order_acq_rel) == 1U) { _active.notify_one(); }
+    }
+}
+
+inline auto ForkJoinPool::work() -> void
+{
+    for (auto i = _next.fetch_add(1U, std::memory_order_relaxed); i < _numTasks;
+         i      = _next.fetch_add(1U, std::memory_order_relaxed))
+    {
+        _invoke(_task, i);
+    }
+}
+
+inline auto ForkJoinPool::join() -> void
+{
+    // Workers usually finish within a few microseconds of the caller,
+    // spin for a short while before going to sleep.
+    for (auto i{0}; i < 2048; ++i)
+    {
+        if (_active.load(std::memory_order_acquire) == 0U) { return; }
+    }
+
+    for (auto active = _active.load(std::memory_order_acquire); active != 0U;
+         active      = _active.load(std::memory_order_acquire))
+    {
+        _active.wait(active, std::memory_order_acquire);
+    }
+}
+
+}  // namespace lt
\ No newline at end of file
@@ -0,0 +1,59 @@
+#include <lt_core/lt_core.hpp>
+
+#include "catch2/catch_test_macros.hpp"
+
+#include <mutex>
+#include <set>
+#include <thread>
+
+TEST_CASE("core/thread: ForkJoinPool", "[core][thread]")
+{
+    auto const numWorkers = GENERATE(0U, 1U, 3U);
+    auto pool             = lt::ForkJoinPool{numWorkers};
+    REQUIRE(pool.numWorkers() == numWorkers);
+
+    SECTION("no tasks")
+    {
+        auto calls = std::atomic<int>{0};
+        pool.run(0U, [&](std::uint32_t) { ++calls; });
+        REQUIRE(calls.load() == 0);
+    }
+
+    SECTION("every task runs once")
+    {
+        auto counts = std::vector<std::atomic<int>>(37U);
+        for (auto round{0}; round < 200; ++round)
+        {
+            pool.run(37U, [&](std::uint32_t index) { ++counts[index]; });
+        }
+        for (auto const& count : counts) { REQUIRE(count.load() == 200); }
+    }
+
+    SECTION("results are visible after run returns")
+    {
+        auto values = std::vector<std::uint32_t>(8U, 0U);
+        for (auto round{1U}; round <= 100U; ++round)
+        {
+            pool.run(8U, [&](std::uint32_t index) { values[index] = round * index; });
+            for (auto i{0U}; i < 8U; ++i) { REQUIRE(values[i] == round * i); }
+        }
+    }
+
+    SECTION("runOnEachThread")
+    {
+        auto mutex = std::mutex{};
+        auto ids   = std::multiset<std::thread::id>{};
+        for (auto round{0}; round < 50; ++round)
+        {
+            ids.clear();
+            pool.runOnEachThread([&] {
+                auto const lock = std::scoped_lock{mutex};
+                ids.insert(std::this_thread::get_id());
+            });
+
+            REQUIRE(ids.size() == numWorkers + 1U);
+            REQUIRE(ids.count(std::this_thread::get_id()) == 1U);
+            for (auto const& id : ids) { REQUIRE(ids.count(id) == 1U); }
+        }
+    }
+}
\ No newline at end of file
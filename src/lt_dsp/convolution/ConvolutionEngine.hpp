@@ -0,0 +1,202 @@
+#pragma once
+
+namespace lt
+{
+
+/// \brief Block-synchronous uniformly partitioned overlap-save convolution.
+///
+/// \details Each call to processBlock consumes exactly one partition of
+/// input and produces one partition of output, without added latency.
+/// The impulse response partitions and the frequency-domain delay line
+/// of input spectra are kept in pffft's internal layout. Every channel
+/// has its own input history and delay line, the filter is shared.
+template<typename FloatType>
+struct ConvolutionEngine
+{
+    using value_type = FloatType;
+
+    explicit ConvolutionEngine(std::uint32_t partitionSize);
+
+    /// \brief Transforms the impulse response into the partition spectra.
+    /// Allocates, must not be called from the audio thread.
+    auto loadImpulseResponse(Span<FloatType const> impulseResponse) -> void;
+
+    /// \brief Allocates the input history and delay line of each channel.
+    auto prepare(std::uint32_t numChannels) -> void;
+
+    /// \brief Reserves the transform work memory on the calling thread.
+    /// prepare() and loadImpulseResponse() do it on theirs, any other
+    /// thread must call this before its first processBlock().
+    auto reserveScratch() const -> void;
+
+    /// \brief Convolves one partition of input, both spans must be partitionSize long.
+    auto processBlock(std::uint32_t channel, Span<FloatType const> input, Span<FloatType> output) -> void;
+
+    auto reset() -> void;
+
+    [[nodiscard]] auto partitionSize() const noexcept -> std::uint32_t;
+    [[nodiscard]] auto numPartitions() const noexcept -> std::uint32_t;
+    [[nodiscard]] auto numChannels() const noexcept -> std::uint32_t;
+
+private:
+    using Fft          = pffft::Fft<FloatType>;
+    using SpectrumType = pffft::AlignedVector<FloatType>;
+
+    auto resizeChannels() -> void;
+
+    [[nodiscard]] auto fftSize() const noexcept -> std::uint32_t;
+
+    std::unique_ptr<Fft> _fft;
+
+    SpectrumType _filterSpectra{};
+    SpectrumType _accumulator{};
+    SpectrumType _timeBuffer{};
+
+    std::vector<SpectrumType> _delayLines{};
+    std::vector<CircularBuffer<value_type>> _inputBuffers{};
+    std::vector<std::uint32_t> _delayLineIndices{};
+
+    std::uint32_t _partitionSize;
+    std::uint32_t _numPartitions{0};
+    std::uint32_t _numChannels{0};
+};
+
+template<typename FloatType>
+ConvolutionEngine<FloatType>::ConvolutionEngine(std::uint32_t partitionSize)
+    : _fft{std::make_unique<Fft>(signCast<int>(partitionSize * 2U))}, _partitionSize{partitionSize}
+{
+    jassert(_fft->isValid());
+    _accumulator = _fft->internalLayoutVector();
+    _timeBuffer  = _fft->valueVector();
+}
+
+template<typename FloatType>
+auto ConvolutionEngine<FloatType>::loadImpulseResponse(Span<FloatType const> impulseResponse) -> void
+{
+    _fft->reserveScratch();
+
+    auto const size = narrowCast<std::uint32_t>(std::size(impulseResponse));
+    _numPartitions  = std::max(1U, (size + _partitionSize - 1U) / _partitionSize);
+    _filterSpectra.assign(static_cast<std::size_t>(_numPartitions) * fftSize(), FloatType{});
+
+    // The inverse transform is unscaled, fold 1/N into the filter.
+    auto const scale = FloatType{1} / static_cast<FloatType>(fftSize());
+
+    for (auto p{0U}; p < _numPartitions; ++p)
+    {
+        auto const first = p * _partitionSize;
+        auto const count = std::min(_partitionSize, size - std::min(size, first));
+        auto const part  = impulseResponse.subspan(first, count);
+
+        std::fill(std::begin(_timeBuffer), std::end(_timeBuffer), FloatType{});
+        std::transform(std::begin(part), std::end(part), std::begin(_timeBuffer), [=](auto s) { return s * scale; });
+        _fft->forwardToInternalLayout(_timeBuffer.data(), std::next(_filterSpectra.data(), p * fftSize()));
+    }
+
+    resizeChannels();
+}
+
+template<typename FloatType>
+auto ConvolutionEngine<FloatType>::prepare(std::uint32_t numChannels) -> void
+{
+    _numChannels = numChannels;
+    resizeChannels();
+    reserveScratch();
+}
+
+template<typename FloatType>
+auto ConvolutionEngine<FloatType>::reserveScratch() const -> void
+{
+    _fft->reserveScratch();
+}
+
+template<typename FloatType>
+auto ConvolutionEngine<FloatType>::processBlock(std::uint32_t channel, Span<FloatType const> input,
+                                                Span<FloatType> output) -> void
+{
+    jassert(channel < _numChannels);
+    jassert(std::size(input) == _partitionSize);
+    jassert(std::size(output) == _partitionSize);
+
+    auto& history = _inputBuffers[channel];
+    history.write(input);
+
+    if (_numPartitions == 0U)
+    {
+        std::fill(std::begin(output), std::end(output), FloatType{});
+        return;
+    }
+
+    auto const spectrumSize = fftSize();
+    auto const* filter      = _filterSpectra.data();
+    auto* line              = _delayLines[channel].data();
+    auto& index             = _delayLineIndices[channel];
+
+    history.copyTo(Span<FloatType>{_timeBuffer});
+
+    // The newest spectrum goes into the slot of the oldest one, the
+    // delay line is then walked backwards in time starting from it.
+    _fft->forwardToInternalLayout(_timeBuffer.data(), std::next(line, index * spectrumSize));
+
+    auto slot = index;
+    _fft->convolve(std::next(line, slot * spectrumSize), filter, _accumulator.data(), FloatType{1});
+    for (auto p{1U}; p < _numPartitions; ++p)
+    {
+        slot = slot == 0U ? _numPartitions - 1U : slot - 1U;
+        _fft->convolveAccumulate(std::next(line, slot * spectrumSize), std::next(filter, p * spectrumSize),
+                                 _accumulator.data(), FloatType{1});
+    }
+
+    _fft->inverseFromInternalLayout(_accumulator.data(), _timeBuffer.data());
+
+    // Overlap-save, only the second half is free of circular aliasing.
+    auto const first = std::next(std::cbegin(_timeBuffer), _partitionSize);
+    std::copy(first, std::cend(_timeBuffer), std::begin(output));
+
+    if (++index; index >= _numPartitions) { index = 0; }
+}
+
+template<typename FloatType>
+auto ConvolutionEngine<FloatType>::reset() -> void
+{
+    for (auto& buffer : _inputBuffers) { std::fill(std::begin(buffer), std::end(buffer), FloatType{}); }
+    for (auto& line : _delayLines) { std::fill(std::begin(line), std::end(line), FloatType{}); }
+    std::fill(std::begin(_delayLineIndices), std::end(_delayLineIndices), 0U);
+}
+
+template<typename FloatType>
+auto ConvolutionEngine<FloatType>::partitionSize() const noexcept -> std::uint32_t
+{
+    return _partitionSize;
+}
+
+template<typename FloatType>
+auto ConvolutionEngine<FloatType>::numPartitions() const noexcept -> std::uint32_t
+{
+    return _numPartitions;
+}
+
+template<typename FloatType>
+auto ConvolutionEngine<FloatType>::numChannels() const noexcept -> std::uint32_t
+{
+    return _numChannels;
+}
+
+template<typename FloatType>
+auto ConvolutionEngine<FloatType>::fftSize() const noexcept -> std::uint32_t
+{
+    return _partitionSize * 2U;
+}
+
+template<typename FloatType>
+auto ConvolutionEngine<FloatType>::resizeChannels() -> void
+{
+    _inputBuffers.resize(_numChannels);
+    _delayLines.resize(_numChannels);
+
+    for (auto& buffer : _inputBuffers) { buffer = CircularBuffer<value_type>{fftSize()}; }
+    for (auto& line : _delayLines) { line.assign(static_cast<std::size_t>(_numPartitions) * fftSize(), FloatType{}); }
+    _delayLineIndices.assign(_numChannels, 0U);
+}
+
+}  // namespace lt
\ No newline at end of file
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+/// \brief Reference convolution for the tests, the output has the length of
+/// the signal.
+template<typename T>
+auto directConvolution(std::vector<T> const& signal, std::vector<T> const& ir) -> std::vector<T>
+{
+    auto out = std::vector<T>(signal.size(), T{});
+    for (auto n{0U}; n < signal.size(); ++n)
+    {
+        for (auto k{0U}; k < ir.size() && k <= n; ++k) { out[n] += signal[n - k] * ir[k]; }
+    }
+    return out;
+}
+
+/// \brief Uniform noise in [-1, 1), reproducible from the seed.
+template<typename T>
+auto randomSignal(std::size_t size, unsigned seed) -> std::vector<T>
+{
+    auto rng  = std::mt19937{seed};
+    auto dist = std::uniform_real_distribution<T>{T(-1), T(1)};
+    auto out  = std::vector<T>(size);
+    std::generate(std::begin(out), std::end(out), [&] { return dist(rng); });
+    return out;
+}
\ No newline at end of file
@@ -0,0 +1,285 @@
+#pragma once
+
+#include <chrono>
+#include <random>
+
+namespace lt
+{
+
+/// \brief Zero-latency convolution, combining a direct-form FIR head
+/// with a uniformly partitioned FFT tail.
+///
+/// \details The first headSize taps are convolved in the time domain,
+/// one vectorized multiply-accumulate over the block per tap. The rest
+/// of the impulse response runs through a PartitionedConvolver with a
+/// partition size of headSize, whose latency of headSize samples lines up
+/// exactly with the start of the tail. Without an explicit head size the
+/// crossover is chosen by timing both parts for every valid candidate
+/// up to maxHeadSize and picking the cheapest per sample.
+template<typename FloatType>
+struct HybridConvolver
+{
+    using value_type = FloatType;
+
+    explicit HybridConvolver(std::uint32_t maxHeadSize = 1024U);
+
+    /// \brief Loads the impulse response and measures the crossover point.
+    /// Allocates and runs the cost model, must not be called from the audio thread.
+    auto loadImpulseResponse(Span<FloatType const> impulseResponse) -> void;
+
+    /// \brief Loads the impulse response with a fixed crossover point.
+    /// headSize must be a power of two that is a valid partition size.
+    auto loadImpulseResponse(Span<FloatType const> impulseResponse, std::uint32_t headSize) -> void;
+
+    auto prepare(juce::dsp::ProcessSpec const& spec) -> void;
+
+    /// \brief Reserves the transform work memory of the tail on the calling
+    /// thread. prepare() and loadImpulseResponse() do it on their own, call
+    /// this once on the audio thread before the first process() if they ran
+    /// on a different one.
+    auto reserveScratch() const -> void;
+
+    template<typename ProcessContext>
+    auto process(ProcessContext const& context) -> void;
+
+    auto reset() -> void;
+
+    [[nodiscard]] auto headSize() const noexcept -> std::uint32_t;
+    [[nodiscard]] auto latency() const noexcept -> std::uint32_t;
+
+    /// \brief Smallest head size the FFT tail can be partitioned with.
+    [[nodiscard]] static auto minHeadSize() -> std::uint32_t;
+
+    /// \brief Measured cost in seconds per sample of one channel for the given head size.
+    [[nodiscard]] static auto measureCost(Span<FloatType const> impulseResponse, std::uint32_t headSize) -> double;
+
+private:
+    auto resizeChannels() -> void;
+    auto processHead(std::uint32_t channel, FloatType* output, std::uint32_t numSamples) -> void;
+
+    std::unique_ptr<PartitionedConvolver<FloatType>> _tail{};
+    std::vector<value_type> _headTaps{};
+    std::vector<std::vector<value_type>> _history{};
+
+    juce::dsp::ProcessSpec _spec{};
+    std::uint32_t _maxHeadSize;
+};
+
+template<typename FloatType>
+HybridConvolver<FloatType>::HybridConvolver(std::uint32_t maxHeadSize) : _maxHeadSize{maxHeadSize}
+{
+    jassert(maxHeadSize >= minHeadSize());
+}
+
+template<typename FloatType>
+auto HybridConvolver<FloatType>::loadImpulseResponse(Span<FloatType const> impulseResponse) -> void
+{
+    auto bestSize = minHeadSize();
+    auto bestCost = std::numeric_limits<double>::max();
+
+    auto const size = narrowCast<std::uint32_t>(std::size(impulseResponse));
+    for (auto candidate{minHeadSize()}; candidate <= _maxHeadSize; candidate *= 2U)
+    {
+        if (auto const cost = measureCost(impulseResponse, candidate); cost < bestCost)
+        {
+            bestCost = cost;
+            bestSize = candidate;
+        }
+
+        // Once the whole response fits into the head, larger heads only add work.
+        if (candidate >= size) { break; }
+    }
+
+    loadImpulseResponse(impulseResponse, bestSize);
+}
+
+template<typename FloatType>
+auto HybridConvolver<FloatType>::loadImpulseResponse(Span<FloatType const> impulseResponse, std::uint32_t headSize)
+    -> void
+{
+    jassert(headSize >= minHeadSize());
+    jassert(juce::isPowerOfTwo(headSize));
+
+    auto const size = narrowCast<std::uint32_t>(std::size(impulseResponse));
+    auto const head = impulseResponse.first(std::min(size, headSize));
+
+    _headTaps.assign(headSize, FloatType{});
+    std::copy(std::begin(head), std::end(head), std::begin(_headTaps));
+
+    _tail.reset();
+    if (size > headSize)
+    {
+        _tail = std::make_unique<PartitionedConvolver<FloatType>>(headSize);
+        _tail->loadImpulseResponse(impulseResponse.subspan(headSize));
+    }
+
+    resizeChannels();
+}
+
+template<typename FloatType>
+auto HybridConvolver<FloatType>::prepare(juce::dsp::ProcessSpec const& spec) -> void
+{
+    _spec = spec;
+    resizeChannels();
+}
+
+template<typename FloatType>
+auto HybridConvolver<FloatType>::reserveScratch() const -> void
+{
+    if (_tail != nullptr) { _tail->reserveScratch(); }
+}
+
+template<typename FloatType>
+template<typename ProcessContext>
+auto HybridConvolver<FloatType>::process(ProcessContext const& context) -> void
+{
+    static_assert(std::is_same_v<FloatType, typename ProcessContext::SampleType>);
+
+    auto inBlock  = context.getInputBlock();
+    auto outBlock = context.getOutputBlock();
+
+    jassert(inBlock.getNumChannels() == outBlock.getNumChannels());
+    jassert(inBlock.getNumSamples() == outBlock.getNumSamples());
+    jassert(inBlock.getNumChannels() == std::size(_history));
+
+    if (std::empty(_headTaps))
+    {
+        outBlock.clear();
+        return;
+    }
+
+    auto const numSamples  = narrowCast<std::uint32_t>(inBlock.getNumSamples());
+    auto const numChannels = inBlock.getNumChannels();
+    auto const delay       = narrowCast<std::uint32_t>(std::size(_headTaps)) - 1U;
+
+    auto numSamplesProcessed = 0U;
+
+    while (numSamplesProcessed < numSamples)
+    {
+        auto const numSamplesToProcess = std::min(numSamples - numSamplesProcessed, _spec.maximumBlockSize);
+
+        // The input has to be captured before the tail overwrites it in place.
+        for (auto ch{0U}; ch < numChannels; ++ch)
+        {
+            auto inF = std::next(inBlock.getChannelPointer(ch), numSamplesProcessed);
+            auto inL = std::next(inF, numSamplesToProcess);
+            std::copy(inF, inL, std::next(std::begin(_history[ch]), delay));
+        }
+
+        auto subBlock = outBlock.getSubBlock(numSamplesProcessed, numSamplesToProcess);
+        if (_tail != nullptr)
+        {
+            if constexpr (ProcessContext::usesSeparateInputAndOutputBlocks())
+            {
+                auto subInput = inBlock.getSubBlock(numSamplesProcessed, numSamplesToProcess);
+                _tail->process(juce::dsp::ProcessContextNonReplacing<FloatType>{subInput, subBlock});
+            }
+            else
+            {
+                _tail->process(juce::dsp::ProcessContextReplacing<FloatType>{subBlock});
+            }
+        }
+        else
+        {
+            subBlock.clear();
+        }
+
+        for (auto ch{0U}; ch < numChannels; ++ch)
+        {
+            processHead(ch, subBlock.getChannelPointer(ch), numSamplesToProcess);
+        }
+
+        numSamplesProcessed += numSamplesToProcess;
+    }
+}
+
+template<typename FloatType>
+auto HybridConvolver<FloatType>::reset() -> void
+{
+    if (_tail != nullptr) { _tail->reset(); }
+    for (auto& history : _history) { std::fill(std::begin(history), std::end(history), FloatType{}); }
+}
+
+template<typename FloatType>
+auto HybridConvolver<FloatType>::headSize() const noexcept -> std::uint32_t
+{
+    return narrowCast<std::uint32_t>(std::size(_headTaps));
+}
+
+template<typename FloatType>
+auto HybridConvolver<FloatType>::latency() const noexcept -> std::uint32_t
+{
+    return 0U;
+}
+
+template<typename FloatType>
+auto HybridConvolver<FloatType>::minHeadSize() -> std::uint32_t
+{
+    using Fft = pffft::Fft<FloatType>;
+    return signCast<std::uint32_t>(Fft::nextPowerOfTwo(Fft::minFFtsize())) / 2U;
+}
+
+template<typename FloatType>
+auto HybridConvolver<FloatType>::measureCost(Span<FloatType const> impulseResponse, std::uint32_t headSize) -> double
+{
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr auto const blockSize = 512U;
+    static constexpr auto const numRuns   = 5;
+
+    // Enough blocks for the tail to run through several partitions.
+    auto const numBlocks = std::max(4U, (4U * headSize) / blockSize);
+
+    auto rng    = std::minstd_rand{};
+    auto dist   = std::uniform_real_distribution<FloatType>{FloatType(-1), FloatType(1)};
+    auto buffer = juce::AudioBuffer<FloatType>{1, signCast<int>(blockSize)};
+    std::generate(buffer.getWritePointer(0), buffer.getWritePointer(0) + blockSize, [&] { return dist(rng); });
+
+    auto conv = HybridConvolver<FloatType>{headSize};
+    conv.prepare(juce::dsp::ProcessSpec{44100.0, blockSize, 1U});
+    conv.loadImpulseResponse(impulseResponse, headSize);
+
+    auto block = juce::dsp::AudioBlock<FloatType>{buffer};
+    auto best  = std::numeric_limits<double>::max();
+    for (auto run{0}; run < numRuns; ++run)
+    {
+        auto const start = Clock::now();
+        for (auto i{0U}; i < numBlocks; ++i) { conv.process(juce::dsp::ProcessContextReplacing<FloatType>{block}); }
+        auto const elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+        best               = std::min(best, elapsed);
+    }
+
+    return best / static_cast<double>(numBlocks * blockSize);
+}
+
+template<typename FloatType>
+auto HybridConvolver<FloatType>::resizeChannels() -> void
+{
+    if (_tail != nullptr) { _tail->prepare(_spec); }
+
+    auto const delay = std::max<std::size_t>(std::size(_headTaps), 1U) - 1U;
+    _history.resize(_spec.numChannels);
+    for (auto& history : _history) { history.assign(delay + _spec.maximumBlockSize, FloatType{}); }
+}
+
+template<typename FloatType>
+auto HybridConvolver<FloatType>::processHead(std::uint32_t channel, FloatType* output, std::uint32_t numSamples)
+    -> void
+{
+    auto& history    = _history[channel];
+    auto const delay = narrowCast<std::uint32_t>(std::size(_headTaps)) - 1U;
+    auto const count = signCast<int>(numSamples);
+
+    // Transposed direct form, every tap is one multiply-accumulate over
+    // the whole block, so the inner loop is a contiguous SIMD axpy.
+    for (auto k{0U}; k <= delay; ++k)
+    {
+        auto const* input = std::next(history.data(), delay - k);
+        juce::FloatVectorOperations::addWithMultiply(output, input, _headTaps[k], count);
+    }
+
+    auto const first = std::next(std::begin(history), numSamples);
+    std::copy(first, std::next(first, delay), std::begin(history));
+}
+
+}  // namespace lt
\ No newline at end of file
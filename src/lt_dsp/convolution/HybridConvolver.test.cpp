@@ -0,0 +1,68 @@
+#include <lt_dsp/convolution/DirectConvolution.test.hpp>
+#include <lt_dsp/lt_dsp.hpp>
+
+#include "catch2/catch_approx.hpp"
+#include "catch2/catch_template_test_macros.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+template<typename T>
+static auto runHybrid(lt::HybridConvolver<T>& conv, std::vector<T> const& signal, std::uint32_t blockSize)
+    -> std::vector<T>
+{
+    auto const numSamples = static_cast<std::uint32_t>(signal.size());
+
+    auto buffer = juce::AudioBuffer<T>{1, int(numSamples)};
+    std::copy(std::cbegin(signal), std::cend(signal), buffer.getWritePointer(0));
+
+    auto block = juce::dsp::AudioBlock<T>{buffer};
+    for (auto i{0U}; i < numSamples; i += blockSize)
+    {
+        auto subBlock = block.getSubBlock(i, std::min(blockSize, numSamples - i));
+        conv.process(juce::dsp::ProcessContextReplacing<T>{subBlock});
+    }
+
+    return {buffer.getReadPointer(0), buffer.getReadPointer(0) + numSamples};
+}
+
+TEMPLATE_TEST_CASE("dsp/convolution: HybridConvolver", "[dsp][convolution]", float, double)
+{
+    static constexpr auto const audioBlockSize = 29U;
+    static constexpr auto const numSamples     = 2048U;
+
+    auto const ir     = randomSignal<TestType>(700, 42);
+    auto const signal = randomSignal<TestType>(numSamples, 1);
+    auto const expect = directConvolution(signal, ir);
+
+    auto conv = lt::HybridConvolver<TestType>{256U};
+    conv.prepare(juce::dsp::ProcessSpec{44100.0, audioBlockSize, 1U});
+
+    SECTION("fixed head size")
+    {
+        conv.loadImpulseResponse(lt::Span<TestType const>{ir}, 64U);
+        REQUIRE(conv.headSize() == 64U);
+        REQUIRE(conv.latency() == 0U);
+
+        auto const out = runHybrid(conv, signal, audioBlockSize);
+        for (auto i{0U}; i < numSamples; ++i) { REQUIRE(out[i] == Catch::Approx(expect[i]).margin(1e-3)); }
+    }
+
+    SECTION("measured head size")
+    {
+        conv.loadImpulseResponse(lt::Span<TestType const>{ir});
+        REQUIRE(conv.headSize() >= lt::HybridConvolver<TestType>::minHeadSize());
+        REQUIRE(conv.headSize() <= 256U);
+
+        auto const out = runHybrid(conv, signal, audioBlockSize);
+        for (auto i{0U}; i < numSamples; ++i) { REQUIRE(out[i] == Catch::Approx(expect[i]).margin(1e-3)); }
+    }
+
+    SECTION("impulse response shorter than head")
+    {
+        auto const shortIr = randomSignal<TestType>(10, 7);
+        auto const shortEx = directConvolution(signal, shortIr);
+        conv.loadImpulseResponse(lt::Span<TestType const>{shortIr}, 32U);
+
+        auto const out = runHybrid(conv, signal, audioBlockSize);
+        for (auto i{0U}; i < numSamples; ++i) { REQUIRE(out[i] == Catch::Approx(shortEx[i]).margin(1e-4)); }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,376 @@
+#pragma once
+
+namespace lt
+{
+
+/// \brief Non-uniformly partitioned convolution with the tail computed on
+/// background threads.
+///
+/// \details The start of the impulse response is convolved on the audio
+/// thread with small partitions of headSize samples. The rest is split
+/// into segments whose partition size grows by a factor of four up to
+/// maxPartitionSize. Once a segment has collected a full partition of
+/// input, its job is queued on a BackgroundPool, and its result is only
+/// needed one partition later. A segment with partition size S therefore
+/// starts at offset 2 * S - headSize in the impulse response. The latency
+/// is equal to headSize.
+///
+/// Every job is due S samples after it was queued. The pool runs the job
+/// with the earliest deadline first, so the short segments are not held
+/// up by the long ones. The audio thread only waits for a job if its
+/// deadline has been missed, which happens when the pool's realtime
+/// workers are busy with the tails of other convolvers or the sample
+/// rate is so high that the work does not fit in time.
+///
+/// prepare() and loadImpulseResponse() reserve the transform work memory
+/// of the tails on every worker of the pool, so the jobs never allocate.
+template<typename FloatType>
+struct NonUniformConvolver
+{
+    using value_type = FloatType;
+
+    /// \brief Growth factor of the partition size from one segment to the next.
+    static constexpr auto const segmentGrowth = 4U;
+
+    /// \brief With backgroundTail set to false the tail segments are
+    /// computed inline, which is useful for offline rendering. Without a
+    /// pool the tails run on BackgroundPool::shared().
+    explicit NonUniformConvolver(std::uint32_t headSize, std::uint32_t maxPartitionSize = 16384U,
+                                 bool backgroundTail = true, std::shared_ptr<BackgroundPool> pool = nullptr);
+
+    /// \brief Splits the impulse response into segments and transforms them.
+    /// Allocates, must not be called from the audio thread.
+    auto loadImpulseResponse(Span<FloatType const> impulseResponse) -> void;
+
+    auto prepare(juce::dsp::ProcessSpec const& spec) -> void;
+
+    /// \brief Reserves the transform work memory on the calling thread,
+    /// for the tails as well if they are computed inline. prepare() and
+    /// loadImpulseResponse() do it on their own, call this once on the
+    /// audio thread before the first process() if they ran on a different one.
+    auto reserveScratch() const -> void;
+
+    template<typename ProcessContext>
+    auto process(ProcessContext const& context) -> void;
+
+    auto reset() -> void;
+
+    [[nodiscard]] auto latency() const noexcept -> std::uint32_t;
+    [[nodiscard]] auto numTailSegments() const noexcept -> std::uint32_t;
+    [[nodiscard]] auto tailPartitionSize(std::uint32_t segment) const noexcept -> std::uint32_t;
+
+private:
+    struct TailSegment
+    {
+        TailSegment(std::uint32_t partitionSize, Span<FloatType const> impulseResponse, BackgroundPool* pool);
+        ~TailSegment();
+
+        TailSegment(TailSegment const&)                    = delete;
+        auto operator=(TailSegment const&) -> TailSegment& = delete;
+
+        auto prepare(std::uint32_t numChannels, double sampleRate) -> void;
+        auto reset() -> void;
+
+        /// \brief Waits for the running job, publishes its result and starts the next one.
+        auto startJob() -> void;
+        auto waitForJob() -> void;
+        auto run() -> void;
+
+        ConvolutionEngine<FloatType> engine;
+        BackgroundPool* pool;
+        BackgroundPool::Job job;
+        BackgroundPool::Clock::duration period{};
+
+        std::vector<std::vector<value_type>> staging{};
+        std::vector<std::vector<value_type>> jobInput{};
+        std::vector<std::vector<value_type>> jobOutput{};
+        std::vector<std::vector<value_type>> current{};
+    };
+
+    auto resizeChannels() -> void;
+    auto processPartition() -> void;
+
+    ConvolutionEngine<FloatType> _head;
+    std::shared_ptr<BackgroundPool> _pool;
+    std::vector<std::unique_ptr<TailSegment>> _tail{};
+
+    std::vector<std::vector<value_type>> _inputBuffers{};
+    std::vector<std::vector<value_type>> _outputBuffers{};
+
+    std::uint32_t _maxPartitionSize;
+    std::uint32_t _numChannels{0};
+    double _sampleRate{0.0};
+    std::uint32_t _samplesSinceLastPartition{0};
+    std::uint64_t _partitionCount{0};
+    bool _backgroundTail;
+};
+
+template<typename FloatType>
+NonUniformConvolver<FloatType>::TailSegment::TailSegment(std::uint32_t partitionSize,
+                                                         Span<FloatType const> impulseResponse,
+                                                         BackgroundPool* backgroundPool)
+    : engine{partitionSize}
+    , pool{backgroundPool}
+    , job{[](void* segment) { static_cast<TailSegment*>(segment)->run(); }, this}
+{
+    engine.loadImpulseResponse(impulseResponse);
+}
+
+template<typename FloatType>
+NonUniformConvolver<FloatType>::TailSegment::~TailSegment()
+{
+    waitForJob();
+}
+
+template<typename FloatType>
+auto NonUniformConvolver<FloatType>::TailSegment::prepare(std::uint32_t numChannels, double sampleRate) -> void
+{
+    waitForJob();
+    engine.prepare(numChannels);
+
+    // The job's result is needed when the next partition is complete.
+    auto const seconds = std::chrono::duration<double>{sampleRate > 0.0 ? engine.partitionSize() / sampleRate : 0.0};
+    period             = std::chrono::duration_cast<BackgroundPool::Clock::duration>(seconds);
+
+    auto const size = engine.partitionSize();
+    for (auto* buffers : {&staging, &jobInput, &jobOutput, &current})
+    {
+        buffers->resize(numChannels);
+        for (auto& buffer : *buffers) { buffer.assign(size, FloatType{}); }
+    }
+}
+
+template<typename FloatType>
+auto NonUniformConvolver<FloatType>::TailSegment::reset() -> void
+{
+    waitForJob();
+    engine.reset();
+    for (auto* buffers : {&staging, &jobInput, &jobOutput, &current})
+    {
+        for (auto& buffer : *buffers) { std::fill(std::begin(buffer), std::end(buffer), FloatType{}); }
+    }
+}
+
+template<typename FloatType>
+auto NonUniformConvolver<FloatType>::TailSegment::startJob() -> void
+{
+    waitForJob();
+    std::swap(current, jobOutput);
+    std::swap(jobInput, staging);
+
+    if (pool == nullptr)
+    {
+        run();
+        return;
+    }
+
+    pool->submit(job, BackgroundPool::Clock::now() + period);
+}
+
+template<typename FloatType>
+auto NonUniformConvolver<FloatType>::TailSegment::waitForJob() -> void
+{
+    if (pool != nullptr) { pool->wait(job); }
+}
+
+template<typename FloatType>
+auto NonUniformConvolver<FloatType>::TailSegment::run() -> void
+{
+    for (auto ch{0U}; ch < engine.numChannels(); ++ch)
+    {
+        engine.processBlock(ch, Span<FloatType const>{jobInput[ch]}, Span<FloatType>{jobOutput[ch]});
+    }
+}
+
+template<typename FloatType>
+NonUniformConvolver<FloatType>::NonUniformConvolver(std::uint32_t headSize, std::uint32_t maxPartitionSize,
+                                                    bool backgroundTail, std::shared_ptr<BackgroundPool> pool)
+    : _head{headSize}, _pool{std::move(pool)}, _maxPartitionSize{maxPartitionSize}, _backgroundTail{backgroundTail}
+{
+    if (_backgroundTail && _pool == nullptr) { _pool = BackgroundPool::shared(); }
+}
+
+template<typename FloatType>
+auto NonUniformConvolver<FloatType>::loadImpulseResponse(Span<FloatType const> impulseResponse) -> void
+{
+    _tail.clear();
+
+    auto const headSize = _head.partitionSize();
+    auto const size     = narrowCast<std::uint32_t>(std::size(impulseResponse));
+
+    auto partitionSize = headSize * segmentGrowth;
+    auto headEnd       = size;
+    if (partitionSize <= _maxPartitionSize) { headEnd = std::min(size, 2U * partitionSize - headSize); }
+    _head.loadImpulseResponse(impulseResponse.first(headEnd));
+
+    auto first = headEnd;
+    while (first < size)
+    {
+        auto const next = partitionSize * segmentGrowth;
+        auto const last = next <= _maxPartitionSize ? std::min(size, 2U * next - headSize) : size;
+        auto const part = impulseResponse.subspan(first, last - first);
+
+        _tail.push_back(std::make_unique<TailSegment>(partitionSize, part, _backgroundTail ? _pool.get() : nullptr));
+
+        first         = last;
+        partitionSize = next;
+    }
+
+    resizeChannels();
+}
+
+template<typename FloatType>
+auto NonUniformConvolver<FloatType>::prepare(juce::dsp::ProcessSpec const& spec) -> void
+{
+    _numChannels = spec.numChannels;
+    _sampleRate  = spec.sampleRate;
+    resizeChannels();
+}
+
+template<typename FloatType>
+auto NonUniformConvolver<FloatType>::reserveScratch() const -> void
+{
+    _head.reserveScratch();
+    if (!_backgroundTail)
+    {
+        for (auto const& segment : _tail) { segment->engine.reserveScratch(); }
+    }
+}
+
+template<typename FloatType>
+template<typename ProcessContext>
+auto NonUniformConvolver<FloatType>::process(ProcessContext const& context) -> void
+{
+    static_assert(std::is_same_v<FloatType, typename ProcessContext::SampleType>);
+
+    auto inBlock  = context.getInputBlock();
+    auto outBlock = context.getOutputBlock();
+
+    jassert(inBlock.getNumChannels() == outBlock.getNumChannels());
+    jassert(inBlock.getNumSamples() == outBlock.getNumSamples());
+    jassert(inBlock.getNumChannels() == _numChannels);
+
+    auto const numSamples    = signCast<int>(inBlock.getNumSamples());
+    auto const numChannels   = inBlock.getNumChannels();
+    auto const partitionSize = _head.partitionSize();
+
+    auto numSamplesProcessed = 0;
+
+    while (numSamplesProcessed < numSamples)
+    {
+        auto const numSamplesLeftInInput        = numSamples - numSamplesProcessed;
+        auto const numSamplesUntilNextPartition = signCast<int>(partitionSize - _samplesSinceLastPartition);
+        auto const numSamplesToProcess = std::min(numSamplesLeftInInput, numSamplesUntilNextPartition);
+
+        for (auto ch{0U}; ch < numChannels; ++ch)
+        {
+            auto inF = std::next(inBlock.getChannelPointer(ch), numSamplesProcessed);
+            auto inL = std::next(inF, numSamplesToProcess);
+            std::copy(inF, inL, std::next(std::begin(_inputBuffers[ch]), _samplesSinceLastPartition));
+
+            auto outF = std::next(std::cbegin(_outputBuffers[ch]), _samplesSinceLastPartition);
+            auto outL = std::next(outF, numSamplesToProcess);
+            std::copy(outF, outL, std::next(outBlock.getChannelPointer(ch), numSamplesProcessed));
+        }
+
+        numSamplesProcessed += numSamplesToProcess;
+        _samplesSinceLastPartition += signCast<std::uint32_t>(numSamplesToProcess);
+
+        if (_samplesSinceLastPartition == partitionSize)
+        {
+            _samplesSinceLastPartition = 0;
+            processPartition();
+        }
+    }
+}
+
+template<typename FloatType>
+auto NonUniformConvolver<FloatType>::reset() -> void
+{
+    _head.reset();
+    for (auto& segment : _tail) { segment->reset(); }
+    for (auto& buffer : _inputBuffers) { std::fill(std::begin(buffer), std::end(buffer), FloatType{}); }
+    for (auto& buffer : _outputBuffers) { std::fill(std::begin(buffer), std::end(buffer), FloatType{}); }
+    _samplesSinceLastPartition = 0;
+    _partitionCount            = 0;
+}
+
+template<typename FloatType>
+auto NonUniformConvolver<FloatType>::latency() const noexcept -> std::uint32_t
+{
+    return _head.partitionSize();
+}
+
+template<typename FloatType>
+auto NonUniformConvolver<FloatType>::numTailSegments() const noexcept -> std::uint32_t
+{
+    return narrowCast<std::uint32_t>(std::size(_tail));
+}
+
+template<typename FloatType>
+auto NonUniformConvolver<FloatType>::tailPartitionSize(std::uint32_t segment) const noexcept -> std::uint32_t
+{
+    jassert(segment < std::size(_tail));
+    return _tail[segment]->engine.partitionSize();
+}
+
+template<typename FloatType>
+auto NonUniformConvolver<FloatType>::resizeChannels() -> void
+{
+    _head.prepare(_numChannels);
+    for (auto& segment : _tail) { segment->prepare(_numChannels, _sampleRate); }
+
+    if (_backgroundTail && !std::empty(_tail))
+    {
+        _pool->runOnEachWorker([this] {
+            for (auto const& segment : _tail) { segment->engine.reserveScratch(); }
+        });
+    }
+
+    _inputBuffers.resize(_numChannels);
+    _outputBuffers.resize(_numChannels);
+    for (auto& buffer : _inputBuffers) { buffer.assign(_head.partitionSize(), FloatType{}); }
+    for (auto& buffer : _outputBuffers) { buffer.assign(_head.partitionSize(), FloatType{}); }
+
+    _samplesSinceLastPartition = 0;
+    _partitionCount            = 0;
+}
+
+template<typename FloatType>
+auto NonUniformConvolver<FloatType>::processPartition() -> void
+{
+    auto const headSize = _head.partitionSize();
+
+    for (auto ch{0U}; ch < _numChannels; ++ch)
+    {
+        _head.processBlock(ch, Span<FloatType const>{_inputBuffers[ch]}, Span<FloatType>{_outputBuffers[ch]});
+    }
+
+    for (auto& segment : _tail)
+    {
+        auto const ratio  = segment->engine.partitionSize() / headSize;
+        auto const offset = static_cast<std::uint32_t>(_partitionCount % ratio) * headSize;
+
+        for (auto ch{0U}; ch < _numChannels; ++ch)
+        {
+            auto const& in = _inputBuffers[ch];
+            std::copy(std::cbegin(in), std::cend(in), std::next(std::begin(segment->staging[ch]), offset));
+        }
+
+        if (offset + headSize == segment->engine.partitionSize()) { segment->startJob(); }
+
+        // The result published by startJob covers the next full tail
+        // partition, it is mixed into the output one head block at a time.
+        auto const readOffset = static_cast<std::uint32_t>((_partitionCount + 1U) % ratio) * headSize;
+        for (auto ch{0U}; ch < _numChannels; ++ch)
+        {
+            auto const tail = std::next(std::cbegin(segment->current[ch]), readOffset);
+            auto& out       = _outputBuffers[ch];
+            std::transform(std::cbegin(out), std::cend(out), tail, std::begin(out), std::plus<>{});
+        }
+    }
+
+    ++_partitionCount;
+}
+
+}  // namespace lt
\ No newline at end of file
@@ -0,0 +1,52 @@
+#include <lt_dsp/convolution/DirectConvolution.test.hpp>
+#include <lt_dsp/lt_dsp.hpp>
+
+#include "catch2/catch_approx.hpp"
+#include "catch2/catch_template_test_macros.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+TEMPLATE_TEST_CASE("dsp/convolution: NonUniformConvolver", "[dsp][convolution]", float, double)
+{
+    static constexpr auto const headSize       = 16U;
+    static constexpr auto const audioBlockSize = 37U;
+    static constexpr auto const numChannels    = 2U;
+    static constexpr auto const numSamples     = 4096U;
+
+    auto const background = GENERATE(true, false);
+
+    auto const ir     = randomSignal<TestType>(1500, 42);
+    auto const signal = randomSignal<TestType>(numSamples, 1);
+    auto const expect = directConvolution(signal, ir);
+
+    auto conv = lt::NonUniformConvolver<TestType>{headSize, 256U, background};
+    conv.prepare(juce::dsp::ProcessSpec{44100.0, audioBlockSize, numChannels});
+    conv.loadImpulseResponse(lt::Span<TestType const>{ir});
+
+    REQUIRE(conv.latency() == headSize);
+    REQUIRE(conv.numTailSegments() == 2U);
+    REQUIRE(conv.tailPartitionSize(0) == 64U);
+    REQUIRE(conv.tailPartitionSize(1) == 256U);
+
+    auto buffer = juce::AudioBuffer<TestType>{int(numChannels), int(numSamples)};
+    for (auto ch{0}; ch < int(numChannels); ++ch)
+    {
+        std::copy(std::cbegin(signal), std::cend(signal), buffer.getWritePointer(ch));
+    }
+
+    auto block = juce::dsp::AudioBlock<TestType>{buffer};
+    for (auto i{0U}; i < numSamples; i += audioBlockSize)
+    {
+        auto subBlock = block.getSubBlock(i, std::min(audioBlockSize, numSamples - i));
+        conv.process(juce::dsp::ProcessContextReplacing<TestType>{subBlock});
+    }
+
+    for (auto ch{0}; ch < int(numChannels); ++ch)
+    {
+        auto const* out = buffer.getReadPointer(ch);
+        for (auto i{0U}; i < headSize; ++i) { REQUIRE(out[i] == Catch::Approx(0.0).margin(1e-4)); }
+        for (auto i{headSize}; i < numSamples; ++i)
+        {
+            REQUIRE(out[i] == Catch::Approx(expect[i - headSize]).margin(1e-3));
+        }
+    }
+}
\ No newline at end of file
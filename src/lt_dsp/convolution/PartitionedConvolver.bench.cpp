@@ -0,0 +1,85 @@
+#include "lt_dsp/lt_dsp.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <random>
+#include <thread>
+
+static constexpr auto benchmarkNumChannels = 2;
+static constexpr auto benchmarkSampleRate  = 48000.0;
+
+static auto generateImpulseResponse(int channels, int size) -> juce::AudioBuffer<float>
+{
+    auto rng    = std::default_random_engine{};
+    auto dist   = std::uniform_real_distribution<float>{-1.0F, 1.0F};
+    auto buffer = juce::AudioBuffer<float>{channels, size};
+    for (auto ch{0}; ch < channels; ++ch)
+    {
+        auto* samples = buffer.getWritePointer(ch);
+        std::generate(samples, samples + size, [&] { return dist(rng); });
+    }
+    return buffer;
+}
+
+static void juce_Convolution(benchmark::State& state)
+{
+    auto const blockSize = static_cast<int>(state.range(0));
+    auto const irSize    = static_cast<int>(state.range(1));
+    auto const spec      = juce::dsp::ProcessSpec{benchmarkSampleRate, static_cast<std::uint32_t>(blockSize),
+                                             static_cast<std::uint32_t>(benchmarkNumChannels)};
+
+    auto conv = juce::dsp::Convolution{juce::dsp::Convolution::Latency{blockSize}};
+    conv.prepare(spec);
+    conv.loadImpulseResponse(generateImpulseResponse(1, irSize), benchmarkSampleRate, juce::dsp::Convolution::Stereo::no,
+                             juce::dsp::Convolution::Trim::no, juce::dsp::Convolution::Normalise::no);
+
+    auto buffer = generateImpulseResponse(benchmarkNumChannels, blockSize);
+    auto block  = juce::dsp::AudioBlock<float>{buffer};
+
+    // The impulse response is loaded on a background thread and only
+    // swapped in during process, wait until it has been picked up.
+    for (auto i{0}; i < 5000 && conv.getCurrentIRSize() != irSize; ++i)
+    {
+        conv.process(juce::dsp::ProcessContextReplacing<float>{block});
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    if (conv.getCurrentIRSize() != irSize) { state.SkipWithError("impulse response was not loaded"); }
+
+    for (auto _ : state)
+    {
+        conv.process(juce::dsp::ProcessContextReplacing<float>{block});
+        benchmark::DoNotOptimize(buffer.getReadPointer(0));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * blockSize);
+}
+BENCHMARK(juce_Convolution)->ArgsProduct({{128, 512}, {48000 * 2, 48000 * 10}})->Unit(benchmark::kMicrosecond);
+
+static void lt_PartitionedConvolver(benchmark::State& state)
+{
+    auto const blockSize = static_cast<int>(state.range(0));
+    auto const irSize    = static_cast<int>(state.range(1));
+    auto const spec      = juce::dsp::ProcessSpec{benchmarkSampleRate, static_cast<std::uint32_t>(blockSize),
+                                             static_cast<std::uint32_t>(benchmarkNumChannels)};
+
+    auto const ir = generateImpulseResponse(1, irSize);
+
+    auto conv = lt::PartitionedConvolver<float>{static_cast<std::uint32_t>(blockSize)};
+    conv.loadImpulseResponse(lt::Span<float const>{ir.getReadPointer(0), static_cast<std::size_t>(irSize)});
+    conv.prepare(spec);
+
+    auto buffer = generateImpulseResponse(benchmarkNumChannels, blockSize);
+    auto block  = juce::dsp::AudioBlock<float>{buffer};
+
+    for (auto _ : state)
+    {
+        conv.process(juce::dsp::ProcessContextReplacing<float>{block});
+        benchmark::DoNotOptimize(buffer.getReadPointer(0));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * blockSize);
+}
+BENCHMARK(lt_PartitionedConvolver)->ArgsProduct({{128, 512}, {48000 * 2, 48000 * 10}})->Unit(benchmark::kMicrosecond);
\ No newline at end of file
@@ -0,0 +1,176 @@
+#pragma once
+
+namespace lt
+{
+
+/// \brief Uniformly partitioned overlap-save convolution.
+///
+/// \details The impulse response is split into partitions of equal
+/// size, each transformed once into pffft's internal spectrum layout.
+/// Every block of input is transformed once and kept in a
+/// frequency-domain delay line, so a block costs one forward FFT, one
+/// inverse FFT and one complex multiply-accumulate per partition. All
+/// channels share the same impulse response. The latency is equal to
+/// the partition size.
+template<typename FloatType>
+struct PartitionedConvolver
+{
+    using value_type = FloatType;
+
+    explicit PartitionedConvolver(std::uint32_t partitionSize);
+
+    /// \brief Transforms the impulse response into the partition spectra.
+    /// Allocates, must not be called from the audio thread.
+    auto loadImpulseResponse(Span<FloatType const> impulseResponse) -> void;
+
+    auto prepare(juce::dsp::ProcessSpec const& spec) -> void;
+
+    /// \brief Reserves the transform work memory on the calling thread.
+    /// prepare() does it on its own, call this once on the audio thread
+    /// before the first process() if prepare() ran on a different one.
+    auto reserveScratch() const -> void;
+
+    template<typename ProcessContext>
+    auto process(ProcessContext const& context) -> void;
+
+    auto reset() -> void;
+
+    [[nodiscard]] auto partitionSize() const noexcept -> std::uint32_t;
+    [[nodiscard]] auto numPartitions() const noexcept -> std::uint32_t;
+    [[nodiscard]] auto latency() const noexcept -> std::uint32_t;
+
+private:
+    auto resizeChannels() -> void;
+    auto processPartition() -> void;
+
+    ConvolutionEngine<FloatType> _engine;
+
+    std::vector<std::vector<value_type>> _inputBuffers{};
+    std::vector<std::vector<value_type>> _outputBuffers{};
+
+    std::uint32_t _numChannels{0};
+    std::uint32_t _samplesSinceLastPartition{0};
+};
+
+template<typename FloatType>
+PartitionedConvolver<FloatType>::PartitionedConvolver(std::uint32_t partitionSize) : _engine{partitionSize}
+{
+}
+
+template<typename FloatType>
+auto PartitionedConvolver<FloatType>::loadImpulseResponse(Span<FloatType const> impulseResponse) -> void
+{
+    _engine.loadImpulseResponse(impulseResponse);
+    resizeChannels();
+}
+
+template<typename FloatType>
+auto PartitionedConvolver<FloatType>::prepare(juce::dsp::ProcessSpec const& spec) -> void
+{
+    _numChannels = spec.numChannels;
+    resizeChannels();
+}
+
+template<typename FloatType>
+auto PartitionedConvolver<FloatType>::reserveScratch() const -> void
+{
+    _engine.reserveScratch();
+}
+
+template<typename FloatType>
+template<typename ProcessContext>
+auto PartitionedConvolver<FloatType>::process(ProcessContext const& context) -> void
+{
+    static_assert(std::is_same_v<FloatType, typename ProcessContext::SampleType>);
+
+    auto inBlock  = context.getInputBlock();
+    auto outBlock = context.getOutputBlock();
+
+    jassert(inBlock.getNumChannels() == outBlock.getNumChannels());
+    jassert(inBlock.getNumSamples() == outBlock.getNumSamples());
+    jassert(inBlock.getNumChannels() == _numChannels);
+
+    auto const numSamples    = signCast<int>(inBlock.getNumSamples());
+    auto const numChannels   = inBlock.getNumChannels();
+    auto const partitionSize = _engine.partitionSize();
+
+    auto numSamplesProcessed = 0;
+
+    while (numSamplesProcessed < numSamples)
+    {
+        auto const numSamplesLeftInInput        = numSamples - numSamplesProcessed;
+        auto const numSamplesUntilNextPartition = signCast<int>(partitionSize - _samplesSinceLastPartition);
+        auto const numSamplesToProcess = std::min(numSamplesLeftInInput, numSamplesUntilNextPartition);
+
+        for (auto ch{0U}; ch < numChannels; ++ch)
+        {
+            auto inF = std::next(inBlock.getChannelPointer(ch), numSamplesProcessed);
+            auto inL = std::next(inF, numSamplesToProcess);
+            std::copy(inF, inL, std::next(std::begin(_inputBuffers[ch]), _samplesSinceLastPartition));
+
+            auto outF = std::next(std::cbegin(_outputBuffers[ch]), _samplesSinceLastPartition);
+            auto outL = std::next(outF, numSamplesToProcess);
+            std::copy(outF, outL, std::next(outBlock.getChannelPointer(ch), numSamplesProcessed));
+        }
+
+        numSamplesProcessed += numSamplesToProcess;
+        _samplesSinceLastPartition += signCast<std::uint32_t>(numSamplesToProcess);
+
+        if (_samplesSinceLastPartition == partitionSize)
+        {
+            _samplesSinceLastPartition = 0;
+            processPartition();
+        }
+    }
+}
+
+template<typename FloatType>
+auto PartitionedConvolver<FloatType>::reset() -> void
+{
+    _engine.reset();
+    for (auto& buffer : _inputBuffers) { std::fill(std::begin(buffer), std::end(buffer), FloatType{}); }
+    for (auto& buffer : _outputBuffers) { std::fill(std::begin(buffer), std::end(buffer), FloatType{}); }
+    _samplesSinceLastPartition = 0;
+}
+
+template<typename FloatType>
+auto PartitionedConvolver<FloatType>::partitionSize() const noexcept -> std::uint32_t
+{
+    return _engine.partitionSize();
+}
+
+template<typename FloatType>
+auto PartitionedConvolver<FloatType>::numPartitions() const noexcept -> std::uint32_t
+{
+    return _engine.numPartitions();
+}
+
+template<typename FloatType>
+auto PartitionedConvolver<FloatType>::latency() const noexcept -> std::uint32_t
+{
+    return _engine.partitionSize();
+}
+
+template<typename FloatType>
+auto PartitionedConvolver<FloatType>::resizeChannels() -> void
+{
+    _engine.prepare(_numChannels);
+
+    _inputBuffers.resize(_numChannels);
+    _outputBuffers.resize(_numChannels);
+    for (auto& buffer : _inputBuffers) { buffer.assign(_engine.partitionSize(), FloatType{}); }
+    for (auto& buffer : _outputBuffers) { buffer.assign(_engine.partitionSize(), FloatType{}); }
+
+    _samplesSinceLastPartition = 0;
+}
+
+template<typename FloatType>
+auto PartitionedConvolver<FloatType>::processPartition() -> void
+{
+    for (auto ch{0U}; ch < _numChannels; ++ch)
+    {
+        _engine.processBlock(ch, Span<FloatType const>{_inputBuffers[ch]}, Span<FloatType>{_outputBuffers[ch]});
+    }
+}
+
+}  // namespace lt
\ No newline at end of file
@@ -0,0 +1,61 @@
+#include <lt_dsp/convolution/DirectConvolution.test.hpp>
+#include <lt_dsp/lt_dsp.hpp>
+
+#include "catch2/catch_approx.hpp"
+#include "catch2/catch_template_test_macros.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+TEMPLATE_TEST_CASE("dsp/convolution: PartitionedConvolver", "[dsp][convolution]", float, double)
+{
+    static constexpr auto const partitionSize  = 32U;
+    static constexpr auto const audioBlockSize = 23U;
+    static constexpr auto const numChannels    = 2U;
+    static constexpr auto const numSamples     = 1024U;
+
+    auto const ir     = randomSignal<TestType>(100, 42);
+    auto const signal = randomSignal<TestType>(numSamples, 1);
+    auto const expect = directConvolution(signal, ir);
+
+    auto conv = lt::PartitionedConvolver<TestType>{partitionSize};
+    conv.loadImpulseResponse(lt::Span<TestType const>{ir});
+    conv.prepare(juce::dsp::ProcessSpec{44100.0, audioBlockSize, numChannels});
+
+    REQUIRE(conv.partitionSize() == partitionSize);
+    REQUIRE(conv.numPartitions() == 4U);
+    REQUIRE(conv.latency() == partitionSize);
+
+    auto buffer = juce::AudioBuffer<TestType>{int(numChannels), int(numSamples)};
+    for (auto ch{0}; ch < int(numChannels); ++ch)
+    {
+        std::copy(std::cbegin(signal), std::cend(signal), buffer.getWritePointer(ch));
+    }
+
+    auto block = juce::dsp::AudioBlock<TestType>{buffer};
+    for (auto i{0U}; i < numSamples; i += audioBlockSize)
+    {
+        auto subBlock = block.getSubBlock(i, std::min(audioBlockSize, numSamples - i));
+        conv.process(juce::dsp::ProcessContextReplacing<TestType>{subBlock});
+    }
+
+    for (auto ch{0}; ch < int(numChannels); ++ch)
+    {
+        auto const* out = buffer.getReadPointer(ch);
+        for (auto i{0U}; i < partitionSize; ++i) { REQUIRE(out[i] == Catch::Approx(0.0).margin(1e-4)); }
+        for (auto i{partitionSize}; i < numSamples; ++i)
+        {
+            REQUIRE(out[i] == Catch::Approx(expect[i - partitionSize]).margin(1e-4));
+        }
+    }
+
+    SECTION("reset")
+    {
+        conv.reset();
+
+        auto silence = juce::AudioBuffer<TestType>{int(numChannels), int(partitionSize * 2U)};
+        auto silent  = juce::dsp::AudioBlock<TestType>{silence};
+        conv.process(juce::dsp::ProcessContextReplacing<TestType>{silent});
+
+        auto const* out = silence.getReadPointer(0);
+        REQUIRE(std::all_of(out, out + silence.getNumSamples(), [](auto s) { return s == TestType{0}; }));
+    }
+}
\ No newline at end of file
@@ -0,0 +1,81 @@
+#include "lt_dsp/lt_dsp.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+static constexpr auto benchmarkNumChannels = 2U;
+static constexpr auto benchmarkSampleRate  = 48000.0;
+static constexpr auto benchmarkBlockSize   = 512U;
+static constexpr auto benchmarkNumTaps     = 64U;
+static constexpr auto benchmarkMaxDelay    = 2048U;
+
+// One delay line per channel, read by 64 taps with their own modulation.
+template<typename Line>
+static void lt_DelayLine_ModulatedTaps(benchmark::State& state)
+{
+    auto line = Line{benchmarkMaxDelay};
+    line.prepare({benchmarkSampleRate, benchmarkBlockSize, benchmarkNumChannels});
+
+    auto rng   = std::default_random_engine{};
+    auto dist  = std::uniform_real_distribution<float>{-1.0F, 1.0F};
+    auto input = std::vector<float>(benchmarkBlockSize);
+    std::generate(std::begin(input), std::end(input), [&] { return dist(rng); });
+
+    auto delays = std::vector<std::vector<float>>(benchmarkNumTaps);
+    for (auto tap{0U}; tap < benchmarkNumTaps; ++tap)
+    {
+        delays[tap].resize(benchmarkBlockSize);
+        for (auto i{0U}; i < benchmarkBlockSize; ++i)
+        {
+            auto const lfo = std::sin(static_cast<float>(i) * 0.01F + static_cast<float>(tap));
+            delays[tap][i] = 1000.0F + 20.0F * static_cast<float>(tap) + 10.0F * lfo;
+        }
+    }
+
+    auto output = std::vector<float>(benchmarkBlockSize);
+    for (auto _ : state)
+    {
+        for (auto ch{0U}; ch < benchmarkNumChannels; ++ch)
+        {
+            line.write(ch, lt::Span<float const>{input});
+            for (auto const& tap : delays)
+            {
+                line.read(ch, lt::Span<float const>{tap}, lt::Span<float>{output});
+                benchmark::DoNotOptimize(output.data());
+            }
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * benchmarkNumChannels * benchmarkNumTaps * benchmarkBlockSize);
+}
+BENCHMARK_TEMPLATE(lt_DelayLine_ModulatedTaps, lt::DelayLine<float, lt::DelayInterpolation::linear>);
+BENCHMARK_TEMPLATE(lt_DelayLine_ModulatedTaps, lt::DelayLine<float, lt::DelayInterpolation::lagrange>);
+BENCHMARK_TEMPLATE(lt_DelayLine_ModulatedTaps, lt::DelayLine<float, lt::DelayInterpolation::sinc>);
+
+// The allpass is recursive, one modulated voice per channel.
+static void lt_DelayLine_Thiran(benchmark::State& state)
+{
+    auto line = lt::DelayLine<float, lt::DelayInterpolation::thiran>{benchmarkMaxDelay};
+    line.prepare({benchmarkSampleRate, benchmarkBlockSize, benchmarkNumChannels});
+
+    auto input  = std::vector<float>(benchmarkBlockSize, 0.5F);
+    auto delays = std::vector<float>(benchmarkBlockSize);
+    for (auto i{0U}; i < benchmarkBlockSize; ++i)
+    {
+        delays[i] = 100.0F + 10.0F * std::sin(static_cast<float>(i) * 0.01F);
+    }
+
+    auto output = std::vector<float>(benchmarkBlockSize);
+    for (auto _ : state)
+    {
+        for (auto ch{0U}; ch < benchmarkNumChannels; ++ch)
+        {
+            line.process(ch, lt::Span<float const>{input}, lt::Span<float const>{delays}, lt::Span<float>{output});
+            benchmark::DoNotOptimize(output.data());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * benchmarkNumChannels * benchmarkBlockSize);
+}
+BENCHMARK(lt_DelayLine_Thiran);
\ No newline at end of file
@@ -0,0 +1,364 @@
+#pragma once
+
+namespace lt
+{
+
+/// \brief Interpolation used by DelayLine for fractional delays.
+enum struct DelayInterpolation
+{
+    linear,
+    lagrange,
+    thiran,
+    sinc,
+};
+
+/// \brief Multichannel delay line with modulated fractional reads.
+///
+/// \details Every channel is a PowerOfTwoCircularBuffer, so a tap is a
+/// masked index without branches. Delays are in samples behind the
+/// newest sample and are clamped to [minDelay, maxDelay()].
+///
+/// The block functions take one delay per sample. They evaluate the
+/// interpolator in a plain loop over contiguous arrays without data
+/// dependent branches, which the compiler turns into SIMD code with
+/// gathers where the target has them. The sinc kernel instead runs its
+/// eight taps as one contiguous dot product. For many modulated taps,
+/// write() the block once and read() it once per tap.
+///
+/// - linear: two taps.
+/// - lagrange: third order Lagrange, four taps, minDelay is 1.
+/// - thiran: first order allpass, two taps and one state per channel.
+///   It is recursive, so it only works through process() and
+///   processSample(), and runs one sample after the other.
+/// - sinc: Kaiser windowed sinc with eight taps, from a table with
+///   interpolated phases, minDelay is 3.
+template<typename FloatType, DelayInterpolation Interpolation>
+struct DelayLine
+{
+    using value_type = FloatType;
+
+    static constexpr auto sincHalfWidth = 4U;
+    static constexpr auto sincPhases    = 256U;
+
+    /// \brief Shortest supported delay, the interpolator reads this many
+    /// samples ahead of the integer delay.
+    static constexpr auto minDelay = []() -> FloatType {
+        switch (Interpolation)
+        {
+            case DelayInterpolation::lagrange: return FloatType(1);
+            case DelayInterpolation::thiran: return FloatType(0.5);
+            case DelayInterpolation::sinc: return static_cast<FloatType>(sincHalfWidth - 1U);
+            case DelayInterpolation::linear: break;
+        }
+        return FloatType(0);
+    }();
+
+    explicit DelayLine(std::uint32_t maxDelay);
+
+    /// \brief Allocates the channels, blocks must not be longer than
+    /// spec.maximumBlockSize.
+    auto prepare(juce::dsp::ProcessSpec const& spec) -> void;
+    auto reset() -> void;
+
+    [[nodiscard]] auto maxDelay() const noexcept -> std::uint32_t;
+
+    /// \brief Appends samples to the channel, without reading.
+    auto write(std::uint32_t channel, Span<FloatType const> samples) -> void;
+
+    /// \brief Reads the last std::size(delays) written samples, output[i]
+    /// is delays[i] samples behind the i-th of them.
+    auto read(std::uint32_t channel, Span<FloatType const> delays, Span<FloatType> output) const -> void
+        requires(Interpolation != DelayInterpolation::thiran);
+
+    /// \brief write() followed by read(), output may alias input.
+    auto process(std::uint32_t channel, Span<FloatType const> input, Span<FloatType const> delays,
+                 Span<FloatType> output) -> void;
+
+    /// \brief Writes one sample and reads one sample, delay samples behind it.
+    [[nodiscard]] auto processSample(std::uint32_t channel, FloatType sample, FloatType delay) -> FloatType;
+
+private:
+    // Older samples the interpolator reads past the integer delay.
+    static constexpr auto historySize = []() -> std::uint32_t {
+        switch (Interpolation)
+        {
+            case DelayInterpolation::lagrange: return 2U;
+            case DelayInterpolation::sinc: return sincHalfWidth;
+            case DelayInterpolation::linear:
+            case DelayInterpolation::thiran: break;
+        }
+        return 1U;
+    }();
+
+    // Raw storage of a channel, history[n] is the sample n behind the
+    // newest. Signed indices keep the float conversion vectorizable.
+    struct History
+    {
+        explicit History(PowerOfTwoCircularBuffer<FloatType> const& ring) noexcept;
+
+        [[nodiscard]] auto operator[](std::int32_t delay) const noexcept -> FloatType
+        {
+            return data[(newest - delay) & mask];
+        }
+
+        FloatType const* data;
+        std::int32_t newest;
+        std::int32_t mask;
+    };
+
+    // By value, std::clamp returns a reference which keeps the loops scalar.
+    [[nodiscard]] static auto clampDelay(FloatType delay, FloatType upperLimit) noexcept -> FloatType
+    {
+        auto const lower = delay < minDelay ? minDelay : delay;
+        return lower > upperLimit ? upperLimit : lower;
+    }
+
+    [[nodiscard]] auto interpolate(History const& history, FloatType delay) const -> FloatType;
+    auto readThiran(std::uint32_t channel, Span<FloatType const> delays, Span<FloatType> output) -> void;
+    auto fillSincTable() -> void;
+
+    std::vector<PowerOfTwoCircularBuffer<FloatType>> _buffers{};
+    std::vector<FloatType> _allpassStates{};
+    std::vector<FloatType> _sincTable{};
+    std::uint32_t _maxDelay;
+    std::uint32_t _maxBlockSize{0};
+};
+
+template<typename FloatType, DelayInterpolation Interpolation>
+DelayLine<FloatType, Interpolation>::DelayLine(std::uint32_t maxDelay) : _maxDelay{maxDelay}
+{
+    jassert(static_cast<FloatType>(maxDelay) >= minDelay);
+    if constexpr (Interpolation == DelayInterpolation::sinc) { fillSincTable(); }
+}
+
+template<typename FloatType, DelayInterpolation Interpolation>
+auto DelayLine<FloatType, Interpolation>::prepare(juce::dsp::ProcessSpec const& spec) -> void
+{
+    // A sample of the block is up to maxBlockSize - 1 samples older than
+    // the newest one when it is read.
+    _maxBlockSize = std::max(spec.maximumBlockSize, 1U);
+    auto const size = std::bit_ceil(_maxDelay + historySize + _maxBlockSize);
+
+    _buffers.assign(spec.numChannels, PowerOfTwoCircularBuffer<FloatType>{size});
+    _allpassStates.assign(spec.numChannels, FloatType(0));
+}
+
+template<typename FloatType, DelayInterpolation Interpolation>
+auto DelayLine<FloatType, Interpolation>::reset() -> void
+{
+    for (auto& buffer : _buffers)
+    {
+        forEachSegment(buffer.segments(), [](auto span, auto) { std::fill(std::begin(span), std::end(span), 0); });
+    }
+    std::fill(std::begin(_allpassStates), std::end(_allpassStates), FloatType(0));
+}
+
+template<typename FloatType, DelayInterpolation Interpolation>
+auto DelayLine<FloatType, Interpolation>::maxDelay() const noexcept -> std::uint32_t
+{
+    return _maxDelay;
+}
+
+template<typename FloatType, DelayInterpolation Interpolation>
+auto DelayLine<FloatType, Interpolation>::write(std::uint32_t channel, Span<FloatType const> samples) -> void
+{
+    _buffers[channel].write(samples);
+}
+
+template<typename FloatType, DelayInterpolation Interpolation>
+auto DelayLine<FloatType, Interpolation>::read(std::uint32_t channel, Span<FloatType const> delays,
+                                               Span<FloatType> output) const -> void
+    requires(Interpolation != DelayInterpolation::thiran)
+{
+    jassert(std::size(delays) <= _maxBlockSize);
+    jassert(std::size(output) == std::size(delays));
+
+    // The output could alias the history, which stops the compiler from
+    // vectorizing the gathers. A local chunk can't.
+    static constexpr auto const chunkSize = 32U;
+
+    auto const history    = History{_buffers[channel]};
+    auto const count      = narrowCast<std::uint32_t>(std::size(delays));
+    auto const upperLimit = static_cast<FloatType>(_maxDelay);
+    auto chunk            = std::array<FloatType, chunkSize>{};
+
+    for (auto start{0U}; start < count; start += chunkSize)
+    {
+        auto const num = std::min(chunkSize, count - start);
+        auto const* in = std::next(std::data(delays), start);
+
+        for (auto i{0U}; i < num; ++i)
+        {
+            auto const age = static_cast<FloatType>(count - 1U - start - i);
+            chunk[i]       = interpolate(history, clampDelay(in[i], upperLimit) + age);
+        }
+
+        std::copy_n(std::data(chunk), num, std::next(std::data(output), start));
+    }
+}
+
+template<typename FloatType, DelayInterpolation Interpolation>
+auto DelayLine<FloatType, Interpolation>::process(std::uint32_t channel, Span<FloatType const> input,
+                                                  Span<FloatType const> delays, Span<FloatType> output) -> void
+{
+    jassert(std::size(input) <= _maxBlockSize);
+    jassert(std::size(delays) == std::size(input));
+    jassert(std::size(output) == std::size(input));
+
+    _buffers[channel].write(input);
+
+    if constexpr (Interpolation == DelayInterpolation::thiran) { readThiran(channel, delays, output); }
+    else { read(channel, delays, output); }
+}
+
+template<typename FloatType, DelayInterpolation Interpolation>
+auto DelayLine<FloatType, Interpolation>::processSample(std::uint32_t channel, FloatType sample, FloatType delay)
+    -> FloatType
+{
+    auto out = FloatType(0);
+    process(channel, Span<FloatType const>{&sample, 1U}, Span<FloatType const>{&delay, 1U}, Span<FloatType>{&out, 1U});
+    return out;
+}
+
+template<typename FloatType, DelayInterpolation Interpolation>
+auto DelayLine<FloatType, Interpolation>::readThiran(std::uint32_t channel, Span<FloatType const> delays,
+                                                     Span<FloatType> output) -> void
+{
+    auto const history    = History{_buffers[channel]};
+    auto const count      = narrowCast<std::uint32_t>(std::size(delays));
+    auto const upperLimit = static_cast<FloatType>(_maxDelay);
+    auto state            = _allpassStates[channel];
+
+    for (auto i{0U}; i < count; ++i)
+    {
+        // The allpass adds a delay in [0.5, 1.5) to the integer part,
+        // where its coefficient stays well away from the unit circle.
+        auto const delay = clampDelay(delays[i], upperLimit) + static_cast<FloatType>(count - 1U - i);
+        auto const whole = static_cast<std::int32_t>(delay - FloatType(0.5));
+        auto const frac  = delay - static_cast<FloatType>(whole);
+        auto const coeff = (FloatType(1) - frac) / (FloatType(1) + frac);
+
+        state     = coeff * history[whole] + history[whole + 1] - coeff * state;
+        output[i] = state;
+    }
+
+    _allpassStates[channel] = state;
+}
+
+template<typename FloatType, DelayInterpolation Interpolation>
+DelayLine<FloatType, Interpolation>::History::History(PowerOfTwoCircularBuffer<FloatType> const& ring) noexcept
+{
+    // Index 0 of the ring is the oldest sample at the write position, so
+    // the second segment starts at the storage and is as long as the
+    // write position.
+    auto const segments = ring.segments();
+    auto const position = static_cast<std::int32_t>(std::size(segments.second));
+    auto const size     = static_cast<std::int32_t>(ring.size());
+
+    data   = std::empty(segments.second) ? std::data(segments.first) : std::data(segments.second);
+    newest = position + size - 1;
+    mask   = size - 1;
+}
+
+template<typename FloatType, DelayInterpolation Interpolation>
+auto DelayLine<FloatType, Interpolation>::interpolate(History const& history, FloatType delay) const -> FloatType
+{
+    // Delays are never negative here, truncation is floor.
+    auto const whole = static_cast<std::int32_t>(delay);
+    auto const frac  = delay - static_cast<FloatType>(whole);
+
+    if constexpr (Interpolation == DelayInterpolation::linear)
+    {
+        auto const a = history[whole];
+        auto const b = history[whole + 1];
+        return a + frac * (b - a);
+    }
+    else if constexpr (Interpolation == DelayInterpolation::lagrange)
+    {
+        auto const ym1 = history[whole - 1];
+        auto const y0  = history[whole];
+        auto const y1  = history[whole + 1];
+        auto const y2  = history[whole + 2];
+
+        auto const dp1 = frac + FloatType(1);
+        auto const dm1 = frac - FloatType(1);
+        auto const dm2 = frac - FloatType(2);
+
+        auto const cm1 = -frac * dm1 * dm2 / FloatType(6);
+        auto const c0  = dp1 * dm1 * dm2 / FloatType(2);
+        auto const c1  = -dp1 * frac * dm2 / FloatType(2);
+        auto const c2  = dp1 * frac * dm1 / FloatType(6);
+        return cm1 * ym1 + c0 * y0 + c1 * y1 + c2 * y2;
+    }
+    else if constexpr (Interpolation == DelayInterpolation::sinc)
+    {
+        static constexpr auto const numTaps = static_cast<std::int32_t>(sincHalfWidth * 2U);
+
+        // Table rows are in storage order, oldest tap first, so the taps
+        // are one contiguous dot product unless they straddle the wrap.
+        auto const phase  = frac * static_cast<FloatType>(sincPhases);
+        auto const row    = static_cast<std::int32_t>(phase);
+        auto const blend  = phase - static_cast<FloatType>(row);
+        auto const* lower = std::next(_sincTable.data(), row * numTaps);
+        auto const* upper = std::next(lower, numTaps);
+
+        auto const oldest = history.newest - whole - static_cast<std::int32_t>(sincHalfWidth);
+        auto const start  = oldest & history.mask;
+        auto sum          = FloatType(0);
+        if (start + numTaps <= history.mask + 1)
+        {
+            auto const* samples = std::next(history.data, start);
+            for (auto k{0}; k < numTaps; ++k) { sum += (lower[k] + blend * (upper[k] - lower[k])) * samples[k]; }
+        }
+        else
+        {
+            for (auto k{0}; k < numTaps; ++k)
+            {
+                auto const sample = history.data[(start + k) & history.mask];
+                sum += (lower[k] + blend * (upper[k] - lower[k])) * sample;
+            }
+        }
+        return sum;
+    }
+    else
+    {
+        jassertfalse;
+        return FloatType(0);
+    }
+}
+
+template<typename FloatType, DelayInterpolation Interpolation>
+auto DelayLine<FloatType, Interpolation>::fillSincTable() -> void
+{
+    static constexpr auto const numTaps = sincHalfWidth * 2U;
+    static constexpr auto const beta    = FloatType(7);
+
+    auto const pi        = juce::MathConstants<FloatType>::pi;
+    auto const halfWidth = static_cast<FloatType>(sincHalfWidth);
+    auto const norm      = besselI0(beta);
+
+    // One extra row, so the phase interpolation never reads past the end.
+    _sincTable.resize(static_cast<std::size_t>(sincPhases + 1U) * numTaps);
+    for (auto p{0U}; p <= sincPhases; ++p)
+    {
+        auto const frac = static_cast<FloatType>(p) / static_cast<FloatType>(sincPhases);
+        auto* const row = std::next(_sincTable.data(), p * numTaps);
+        auto sum        = FloatType(0);
+
+        for (auto j{0U}; j < numTaps; ++j)
+        {
+            auto const t      = static_cast<FloatType>(j) - (halfWidth - FloatType(1)) - frac;
+            auto const x      = t / halfWidth;
+            auto const window = besselI0(beta * std::sqrt(std::max(FloatType(0), FloatType(1) - x * x))) / norm;
+            auto const sinc   = t == FloatType(0) ? FloatType(1) : std::sin(pi * t) / (pi * t);
+            row[j]            = sinc * window;
+            sum += row[j];
+        }
+
+        // Unity gain at DC for every phase, stored oldest tap first.
+        std::transform(row, std::next(row, numTaps), row, [sum](auto w) { return w / sum; });
+        std::reverse(row, std::next(row, numTaps));
+    }
+}
+
+}  // namespace lt
\ No newline at end of file
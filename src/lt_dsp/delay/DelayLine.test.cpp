@@ -0,0 +1,148 @@
+#include <lt_dsp/lt_dsp.hpp>
+
+#include "catch2/catch_approx.hpp"
+#include "catch2/catch_template_test_macros.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+TEMPLATE_TEST_CASE("dsp/delay: DelayLine", "[dsp][delay]", (lt::DelayLine<float, lt::DelayInterpolation::linear>),
+                   (lt::DelayLine<double, lt::DelayInterpolation::linear>),
+                   (lt::DelayLine<float, lt::DelayInterpolation::lagrange>),
+                   (lt::DelayLine<double, lt::DelayInterpolation::lagrange>),
+                   (lt::DelayLine<float, lt::DelayInterpolation::thiran>),
+                   (lt::DelayLine<double, lt::DelayInterpolation::thiran>),
+                   (lt::DelayLine<float, lt::DelayInterpolation::sinc>),
+                   (lt::DelayLine<double, lt::DelayInterpolation::sinc>))
+{
+    using FloatType = typename TestType::value_type;
+
+    static constexpr auto const maxDelay  = 100U;
+    static constexpr auto const blockSize = 64U;
+
+    auto spec  = juce::dsp::ProcessSpec{44'100.0, blockSize, 2U};
+    auto delay = TestType{maxDelay};
+    delay.prepare(spec);
+    REQUIRE(delay.maxDelay() == maxDelay);
+
+    auto input = std::vector<FloatType>(1024U);
+    std::iota(std::begin(input), std::end(input), FloatType(1));
+
+    SECTION("integer delays are exact")
+    {
+        for (auto const samples : {3U, 4U, 17U, maxDelay})
+        {
+            delay.reset();
+            for (auto i{0U}; i < std::size(input); ++i)
+            {
+                auto const out      = delay.processSample(0U, input[i], static_cast<FloatType>(samples));
+                auto const expected = i >= samples ? input[i - samples] : FloatType(0);
+                REQUIRE(out == Catch::Approx(expected).margin(1e-3));
+            }
+        }
+    }
+
+    SECTION("fractional delay of a sine")
+    {
+        auto const omega   = FloatType(2) * juce::MathConstants<FloatType>::pi * FloatType(0.01);
+        auto const samples = FloatType(10.3);
+
+        auto sine = std::vector<FloatType>(std::size(input));
+        for (auto i{0U}; i < std::size(sine); ++i) { sine[i] = std::sin(omega * static_cast<FloatType>(i)); }
+
+        auto const delays = std::vector<FloatType>(blockSize, samples);
+        auto output       = std::vector<FloatType>(std::size(sine));
+        for (auto i{0U}; i < std::size(sine); i += blockSize)
+        {
+            delay.process(0U, lt::Span<FloatType const>{sine}.subspan(i, blockSize), lt::Span<FloatType const>{delays},
+                          lt::Span<FloatType>{output}.subspan(i, blockSize));
+        }
+
+        // Skip the start up transient.
+        for (auto i{256U}; i < std::size(output); ++i)
+        {
+            auto const expected = std::sin(omega * (static_cast<FloatType>(i) - samples));
+            REQUIRE(output[i] == Catch::Approx(expected).margin(1e-3));
+        }
+    }
+
+    SECTION("block processing matches single samples")
+    {
+        auto single = TestType{maxDelay};
+        single.prepare(spec);
+
+        auto delays = std::vector<FloatType>(std::size(input));
+        for (auto i{0U}; i < std::size(delays); ++i)
+        {
+            delays[i] = FloatType(40) + FloatType(30) * std::sin(static_cast<FloatType>(i) * FloatType(0.05));
+        }
+
+        auto output = std::vector<FloatType>(std::size(input));
+        for (auto i{0U}; i < std::size(input); i += blockSize)
+        {
+            delay.process(1U, lt::Span<FloatType const>{input}.subspan(i, blockSize),
+                          lt::Span<FloatType const>{delays}.subspan(i, blockSize),
+                          lt::Span<FloatType>{output}.subspan(i, blockSize));
+        }
+
+        for (auto i{0U}; i < std::size(input); ++i)
+        {
+            auto const expected = single.processSample(1U, input[i], delays[i]);
+            REQUIRE(output[i] == Catch::Approx(expected).epsilon(1e-4));
+        }
+    }
+
+    SECTION("delays are clamped")
+    {
+        auto clamped    = TestType{maxDelay};
+        auto outOfRange = TestType{maxDelay};
+        clamped.prepare(spec);
+        outOfRange.prepare(spec);
+
+        for (auto const sample : input)
+        {
+            auto const longest  = clamped.processSample(0U, sample, FloatType(maxDelay));
+            auto const shortest = clamped.processSample(1U, sample, TestType::minDelay);
+            REQUIRE(outOfRange.processSample(0U, sample, FloatType(1000)) == longest);
+            REQUIRE(outOfRange.processSample(1U, sample, FloatType(-5)) == shortest);
+        }
+    }
+
+    if constexpr (requires(TestType const& d) {
+                      d.read(0U, lt::Span<FloatType const>{}, lt::Span<FloatType>{});
+                  })
+    {
+        SECTION("multiple modulated taps of one block")
+        {
+            static constexpr auto const numTaps = 8U;
+
+            auto const block = lt::Span<FloatType const>{input}.first(blockSize);
+            delay.write(0U, block);
+
+            for (auto tap{0U}; tap < numTaps; ++tap)
+            {
+                auto delays = std::vector<FloatType>(blockSize);
+                for (auto i{0U}; i < blockSize; ++i)
+                {
+                    auto const depth = FloatType(0.5) * static_cast<FloatType>(tap + 1U);
+                    auto const lfo   = std::sin(static_cast<FloatType>(i) * FloatType(0.1));
+                    delays[i]        = FloatType(4) + depth * (FloatType(1) + lfo);
+                }
+
+                auto output = std::vector<FloatType>(blockSize);
+                delay.read(0U, lt::Span<FloatType const>{delays}, lt::Span<FloatType>{output});
+
+                auto single = TestType{maxDelay};
+                single.prepare(spec);
+                auto expected = std::vector<FloatType>(blockSize);
+                single.process(0U, block, lt::Span<FloatType const>{delays}, lt::Span<FloatType>{expected});
+                REQUIRE(output == expected);
+
+                // Every interpolator reproduces a ramp, once the taps are past the start.
+                for (auto i{16U}; i < blockSize; ++i)
+                {
+                    auto const ramp = block[i] - delays[i];
+                    REQUIRE(output[i] == Catch::Approx(ramp).epsilon(1e-3));
+                }
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -29,7 +29,7 @@ static void juce_FFT_Roundtrip(benchmark::State& state)
     auto const size  = 1 << order;
     auto fft         = juce::dsp::FFT{order};
 
-    auto const testData = generateData<float>(state.range(0));
+    auto const testData = generateData<float>(static_cast<size_t>(size));
 
     auto input = std::vector<juce::dsp::Complex<float>>{};
     input.resize(size);
@@ -51,15 +51,23 @@ static void juce_FFT_Roundtrip(benchmark::State& state)
         benchmark::ClobberMemory();
     }
 }
-BENCHMARK(juce_FFT_Roundtrip)->Arg(8)->Arg(9)->Arg(10)->Arg(11)->Arg(12)->Arg(13);
+BENCHMARK(juce_FFT_Roundtrip)->DenseRange(8, 16);
 
-static void pffft_float_Roundtrip(benchmark::State& state)
+// Runs with the given SIMD kernel, see registerPffftRoundtrips().
+template<typename T>
+static void pffft_Roundtrip(benchmark::State& state, char const* arch)
 {
+    using Fft = pffft::Fft<std::complex<T>>;
+
     auto const order = static_cast<int>(state.range(0));
     auto const size  = 1 << order;
-    auto fft         = pffft::Fft<std::complex<float>>(size);
 
-    auto const testData = generateData<float>(state.range(0));
+    Fft::select_simd_arch(arch);
+    auto fft = Fft(size);
+    Fft::select_simd_arch(nullptr);
+    state.SetLabel(fft.setupSimdArch());
+
+    auto const testData = generateData<T>(static_cast<size_t>(size));
 
     auto input  = fft.valueVector();
     auto output = fft.spectrumVector();
@@ -68,7 +76,7 @@ static void pffft_float_Roundtrip(benchmark::State& state)
     {
         state.PauseTiming();
         std::copy(cbegin(testData), cend(testData), begin(input));
-        std::fill(begin(output), end(output), juce::dsp::Complex<float>{});
+        std::fill(begin(output), end(output), juce::dsp::Complex<T>{});
         state.ResumeTiming();
 
         fft.forward(input, output);
@@ -79,34 +87,45 @@ static void pffft_float_Roundtrip(benchmark::State& state)
         benchmark::ClobberMemory();
     }
 }
-BENCHMARK(pffft_float_Roundtrip)->Arg(8)->Arg(9)->Arg(10)->Arg(11)->Arg(12)->Arg(13);
 
-static void pffft_double_Roundtrip(benchmark::State& state)
+// One roundtrip per kernel the runtime dispatch accepts, so a single run
+// compares them. Without dispatch only the compiled backend is accepted.
+template<typename T>
+static auto registerPffftRoundtrips(std::string const& name) -> int
 {
-    auto const order = static_cast<int>(state.range(0));
-    auto const size  = 1 << order;
-    auto fft         = pffft::Fft<std::complex<double>>(size);
+    using Fft = pffft::Fft<std::complex<T>>;
 
-    auto const testData = generateData<double>(state.range(0));
-
-    auto input  = fft.valueVector();
-    auto output = fft.spectrumVector();
+    auto archs = std::vector<char const*>{};
+    for (auto const* arch : {"SSE1", "SSE2", "AVX+FMA", "AVX-512"})
+    {
+        if (Fft::select_simd_arch(arch)) { archs.push_back(arch); }
+    }
+    Fft::select_simd_arch(nullptr);
+    if (archs.empty()) { archs.push_back(Fft::simd_arch()); }
 
-    for (auto _ : state)
+    for (auto const* arch : archs)
     {
-        state.PauseTiming();
-        std::copy(cbegin(testData), cend(testData), begin(input));
-        std::fill(begin(output), end(output), juce::dsp::Complex<double>{});
-        state.ResumeTiming();
+        benchmark::RegisterBenchmark((name + "/" + arch).c_str(), pffft_Roundtrip<T>, arch)->DenseRange(8, 16);
+    }
+    return 0;
+}
 
-        fft.forward(input, output);
-        fft.inverse(output, input);
+[[maybe_unused]] static auto const pffftFloatRoundtrips = registerPffftRoundtrips<float>("pffft_float_Roundtrip");
 
-        benchmark::DoNotOptimize(input.data());
-        benchmark::DoNotOptimize(output.data());
-        benchmark::ClobberMemory();
+// Another processor of the same size already exists, as in a session with many plugin instances.
+static void pffft_float_Construct(benchmark::State& state)
+{
+    auto const size     = 1 << static_cast<int>(state.range(0));
+    auto const existing = pffft::Fft<std::complex<float>>(size);
+
+    for (auto _ : state)
+    {
+        auto fft = pffft::Fft<std::complex<float>>(size);
+        benchmark::DoNotOptimize(&fft);
     }
 }
-BENCHMARK(pffft_double_Roundtrip)->Arg(8)->Arg(9)->Arg(10)->Arg(11)->Arg(12)->Arg(13);
+BENCHMARK(pffft_float_Construct)->DenseRange(8, 16, 4);
+
+[[maybe_unused]] static auto const pffftDoubleRoundtrips = registerPffftRoundtrips<double>("pffft_double_Roundtrip");
 
 BENCHMARK_MAIN();
\ No newline at end of file
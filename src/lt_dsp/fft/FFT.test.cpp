@@ -0,0 +1,304 @@
+#include <lt_dsp/lt_dsp.hpp>
+
+#include "pffft.hpp"
+
+#include "catch2/catch_approx.hpp"
+#include "catch2/catch_template_test_macros.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+#include <random>
+#include <thread>
+
+namespace
+{
+
+template<typename T>
+auto naiveDft(std::vector<std::complex<T>> const& input) -> std::vector<std::complex<T>>
+{
+    auto const size = std::size(input);
+    auto output     = std::vector<std::complex<T>>(size);
+    for (auto k = std::size_t{0}; k < size; ++k)
+    {
+        auto sum = std::complex<long double>{};
+        for (auto n = std::size_t{0}; n < size; ++n)
+        {
+            auto const phase = -2.0L * juce::MathConstants<long double>::pi * static_cast<long double>(k * n % size)
+                             / static_cast<long double>(size);
+            sum += std::complex<long double>{input[n]} * std::polar(1.0L, phase);
+        }
+        output[k] = std::complex<T>{sum};
+    }
+    return output;
+}
+
+}  // namespace
+
+TEMPLATE_TEST_CASE("dsp/fft: pffft kernels", "[dsp][fft]", float, double)
+{
+    using Complex = std::complex<TestType>;
+    using Fft     = pffft::Fft<Complex>;
+
+    static constexpr auto const size = 256;
+
+    auto rng    = std::mt19937{42};
+    auto dist   = std::uniform_real_distribution<TestType>{TestType(-1), TestType(1)};
+    auto signal = std::vector<Complex>(size);
+    std::generate(std::begin(signal), std::end(signal), [&] { return Complex{dist(rng), dist(rng)}; });
+    auto const expected = naiveDft(signal);
+
+    // Every kernel this build has and the CPU supports must compute the same transform.
+    auto const automatic = std::string{Fft::simd_arch()};
+    auto tested          = std::vector<std::string>{};
+    for (auto const* arch : {"SSE1", "SSE2", "AVX+FMA", "AVX-512"})
+    {
+        if (!Fft::select_simd_arch(arch)) { continue; }
+        REQUIRE(std::string{Fft::simd_arch()} == arch);
+        tested.emplace_back(arch);
+
+        auto fft = Fft{size};
+        REQUIRE(std::string{fft.setupSimdArch()} == arch);
+
+        auto input    = fft.valueVector();
+        auto spectrum = fft.spectrumVector();
+        std::copy(std::cbegin(signal), std::cend(signal), std::begin(input));
+        fft.forward(input, spectrum);
+
+        for (auto k = std::size_t{0}; k < std::size(expected); ++k)
+        {
+            REQUIRE(spectrum[k].real() == Catch::Approx(expected[k].real()).margin(1e-3));
+            REQUIRE(spectrum[k].imag() == Catch::Approx(expected[k].imag()).margin(1e-3));
+        }
+    }
+
+    REQUIRE(Fft::select_simd_arch(nullptr));
+    REQUIRE(Fft::simd_arch() == automatic);
+    REQUIRE(std::find(std::cbegin(tested), std::cend(tested), automatic) != std::cend(tested));
+
+    // A setup keeps working with its kernel when the selection changes.
+    auto fft   = Fft{size};
+    auto input = fft.valueVector();
+    std::copy(std::cbegin(signal), std::cend(signal), std::begin(input));
+    REQUIRE(Fft::select_simd_arch(tested.front().c_str()));
+
+    auto spectrum = fft.spectrumVector();
+    auto output   = fft.valueVector();
+    fft.forward(input, spectrum);
+    fft.inverse(spectrum, output);
+    REQUIRE(Fft::select_simd_arch(nullptr));
+
+    for (auto n = std::size_t{0}; n < std::size(signal); ++n)
+    {
+        REQUIRE(output[n].real() / TestType(size) == Catch::Approx(signal[n].real()).margin(1e-5));
+        REQUIRE(output[n].imag() / TestType(size) == Catch::Approx(signal[n].imag()).margin(1e-5));
+    }
+}
+
+TEMPLATE_TEST_CASE("dsp/fft: pffft kernel fallback", "[dsp][fft]", float, double)
+{
+    using Complex = std::complex<TestType>;
+    using Fft     = pffft::Fft<Complex>;
+
+    // Valid for 4 element vectors only, the wider kernels hand it to a narrower one.
+    static constexpr auto const size = 48;
+
+    auto rng    = std::mt19937{42};
+    auto dist   = std::uniform_real_distribution<TestType>{TestType(-1), TestType(1)};
+    auto signal = std::vector<Complex>(size);
+    std::generate(std::begin(signal), std::end(signal), [&] { return Complex{dist(rng), dist(rng)}; });
+    auto const expected = naiveDft(signal);
+
+    for (auto const* arch : {"SSE1", "SSE2", "AVX+FMA", "AVX-512"})
+    {
+        if (!Fft::select_simd_arch(arch)) { continue; }
+
+        auto fft = Fft{size};
+        REQUIRE(fft.isValid());
+
+        auto const width = Fft::simd_size();
+        REQUIRE((std::string{fft.setupSimdArch()} == arch) == (size % (width * width) == 0));
+
+        auto input    = fft.valueVector();
+        auto spectrum = fft.spectrumVector();
+        std::copy(std::cbegin(signal), std::cend(signal), std::begin(input));
+        fft.forward(input, spectrum);
+
+        for (auto k = std::size_t{0}; k < std::size(expected); ++k)
+        {
+            REQUIRE(spectrum[k].real() == Catch::Approx(expected[k].real()).margin(1e-3));
+            REQUIRE(spectrum[k].imag() == Catch::Approx(expected[k].imag()).margin(1e-3));
+        }
+    }
+
+    REQUIRE(Fft::select_simd_arch(nullptr));
+}
+
+TEMPLATE_TEST_CASE("dsp/fft: pffft setup cache", "[dsp][fft]", float, double)
+{
+    using RealFft    = pffft::Fft<TestType>;
+    using ComplexFft = pffft::Fft<std::complex<TestType>>;
+
+    auto const before = pffft::cachedSetupCount();
+
+    SECTION("instances of the same length and type share one setup")
+    {
+        auto a       = RealFft{1024};
+        auto b       = RealFft{1024};
+        auto c       = RealFft{2048};
+        auto complex = ComplexFft{1024};
+        REQUIRE(a.sharesSetupWith(b));
+        REQUIRE_FALSE(a.sharesSetupWith(c));
+        REQUIRE(pffft::cachedSetupCount() == before + 3);
+
+        b.prepareLength(2048);
+        REQUIRE(b.sharesSetupWith(c));
+        REQUIRE_FALSE(a.sharesSetupWith(b));
+
+        auto invalid = RealFft{1000};
+        REQUIRE_FALSE(invalid.isValid());
+        REQUIRE_FALSE(invalid.sharesSetupWith(RealFft{1000}));
+        REQUIRE(pffft::cachedSetupCount() == before + 3);
+    }
+
+    SECTION("setups are released with the last instance")
+    {
+        {
+            auto a = RealFft{4096};
+            auto b = RealFft{4096};
+            REQUIRE(pffft::cachedSetupCount() == before + 1);
+        }
+        REQUIRE(pffft::cachedSetupCount() == before);
+    }
+
+    SECTION("prewarm keeps setups alive")
+    {
+        REQUIRE(RealFft::prewarm(8192));
+        REQUIRE(ComplexFft::prewarm(8192));
+        REQUIRE_FALSE(RealFft::prewarm(1000));
+        REQUIRE_FALSE(RealFft::prewarm(0));
+        REQUIRE(pffft::cachedSetupCount() == before + 2);
+
+        { auto fft = RealFft{8192}; }
+        REQUIRE(pffft::cachedSetupCount() == before + 2);
+
+        auto fft = RealFft{8192};
+        pffft::releasePrewarmedSetups();
+        REQUIRE(pffft::cachedSetupCount() == before + 1);
+    }
+
+    SECTION("concurrent construction")
+    {
+        static constexpr auto const size = 512;
+
+        auto reference = RealFft{size};
+        auto input     = reference.valueVector();
+        auto expected  = reference.spectrumVector();
+        std::iota(std::begin(input), std::end(input), TestType(0));
+        reference.forward(input, expected);
+
+        // Catch assertions are not thread safe, only check on this thread.
+        auto shared  = std::vector<char>(8U);
+        auto matches = std::vector<char>(8U);
+        auto threads = std::vector<std::thread>{};
+        for (auto t = std::size_t{0}; t < std::size(shared); ++t)
+        {
+            threads.emplace_back([&, t] {
+                for (auto i{0}; i < 50; ++i)
+                {
+                    auto fft      = RealFft{size};
+                    auto spectrum = fft.spectrumVector();
+                    fft.forward(input, spectrum);
+                    shared[t]  = fft.sharesSetupWith(reference);
+                    matches[t] = std::equal(std::cbegin(spectrum), std::cend(spectrum), std::cbegin(expected));
+                }
+            });
+        }
+        for (auto& thread : threads) { thread.join(); }
+
+        REQUIRE(std::all_of(std::cbegin(shared), std::cend(shared), [](auto v) { return v != 0; }));
+        REQUIRE(std::all_of(std::cbegin(matches), std::cend(matches), [](auto v) { return v != 0; }));
+        REQUIRE(pffft::cachedSetupCount() == before + 1);
+    }
+
+    REQUIRE(pffft::cachedSetupCount() == before);
+}
+
+TEMPLATE_TEST_CASE("dsp/fft: pffft scratch arena", "[dsp][fft]", float, double)
+{
+    using Fft = pffft::Fft<std::complex<TestType>>;
+
+    static constexpr auto const size = 8192;
+
+    SECTION("grows to the largest transform of the thread")
+    {
+        // A fresh thread has no scratch memory yet.
+        auto capacities = std::vector<std::size_t>{};
+        std::thread{[&capacities] {
+            capacities.push_back(pffft::scratchCapacity());
+
+            auto small = Fft{256};
+            capacities.push_back(pffft::scratchCapacity());
+
+            auto large = Fft{size};
+            capacities.push_back(pffft::scratchCapacity());
+
+            auto input    = small.valueVector();
+            auto spectrum = small.spectrumVector();
+            small.forward(input, spectrum);
+            capacities.push_back(pffft::scratchCapacity());
+        }}.join();
+
+        REQUIRE(capacities[0] == 0U);
+        REQUIRE(capacities[1] == 256U * sizeof(std::complex<TestType>));
+        REQUIRE(capacities[2] == size * sizeof(std::complex<TestType>));
+        REQUIRE(capacities[3] == capacities[2]);
+    }
+
+    SECTION("reserveScratch on another thread")
+    {
+        auto fft      = Fft{size};
+        auto capacity = std::size_t{0};
+        std::thread{[&] {
+            fft.reserveScratch();
+            capacity = pffft::scratchCapacity();
+        }}.join();
+
+        REQUIRE(capacity == size * sizeof(std::complex<TestType>));
+    }
+
+    SECTION("one instance used from many threads")
+    {
+        auto fft    = Fft{size};
+        auto rng    = std::mt19937{42};
+        auto dist   = std::uniform_real_distribution<TestType>{TestType(-1), TestType(1)};
+        auto signal = fft.valueVector();
+        std::generate(std::begin(signal), std::end(signal), [&] { return std::complex{dist(rng), dist(rng)}; });
+
+        auto expected = fft.spectrumVector();
+        fft.forward(signal, expected);
+
+        // Catch assertions are not thread safe, only check on this thread.
+        auto matches = std::vector<char>(4U);
+        auto threads = std::vector<std::thread>{};
+        for (auto t = std::size_t{0}; t < std::size(matches); ++t)
+        {
+            threads.emplace_back([&, t] {
+                // The transforms do not grow the arena, see reserveScratch().
+                fft.reserveScratch();
+
+                auto spectrum = fft.spectrumVector();
+                auto output   = fft.valueVector();
+                auto match    = true;
+                for (auto i{0}; i < 20; ++i)
+                {
+                    fft.forward(signal, spectrum);
+                    fft.inverse(spectrum, output);
+                    match = match && std::equal(std::cbegin(spectrum), std::cend(spectrum), std::cbegin(expected));
+                }
+                matches[t] = match;
+            });
+        }
+        for (auto& thread : threads) { thread.join(); }
+
+        REQUIRE(std::all_of(std::cbegin(matches), std::cend(matches), [](auto v) { return v != 0; }));
+    }
+}
\ No newline at end of file
@@ -24,7 +24,18 @@
 #include <juce_dsp/juce_dsp.h>
 #include <lt_core/lt_core.hpp>
 
+#include "pffft.hpp"
+
 // clang-format off
+#include "convolution/ConvolutionEngine.hpp"
+#include "convolution/NonUniformConvolver.hpp"
+#include "convolution/PartitionedConvolver.hpp"
+#include "convolution/HybridConvolver.hpp"
 #include "fft/FourierBin.hpp"
+#include "window/Window.hpp"
+#include "delay/DelayLine.hpp"
+#include "processor/SpectralProcessor.hpp"
 #include "processor/OverlapAddProcessor.hpp"
+#include "processor/OverlapSaveProcessor.hpp"
+#include "processor/StaticOverlapAddProcessor.hpp"
 // clang-format on
\ No newline at end of file
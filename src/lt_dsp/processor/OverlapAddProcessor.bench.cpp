@@ -0,0 +1,305 @@
+#include "lt_dsp/lt_dsp.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+static constexpr auto benchmarkNumChannels = 2;
+static constexpr auto benchmarkSampleRate  = 48000.0;
+static constexpr auto benchmarkBlockSize   = 512;
+
+struct BenchmarkPassthrough
+{
+    auto prepare(juce::dsp::ProcessSpec const& /*spec*/) -> void {}
+
+    template<typename ProcessContext>
+    auto process(ProcessContext const& context) -> void
+    {
+        benchmark::DoNotOptimize(context.getOutputBlock().getChannelPointer(0));
+    }
+
+    auto reset() -> void {}
+};
+
+struct BenchmarkSpectralGain
+{
+    static constexpr auto spectrumLayout = lt::SpectrumLayout::internal;
+
+    auto prepare(juce::dsp::ProcessSpec const& /*spec*/) -> void {}
+
+    auto processSpectrum(std::uint32_t /*channel*/, lt::Span<float> bins) -> void
+    {
+        juce::FloatVectorOperations::multiply(bins.data(), 0.5F, static_cast<int>(bins.size()));
+    }
+
+    auto reset() -> void {}
+};
+
+static auto generateSignal(int channels, int size) -> juce::AudioBuffer<float>
+{
+    auto rng    = std::default_random_engine{};
+    auto dist   = std::uniform_real_distribution<float>{-1.0F, 1.0F};
+    auto buffer = juce::AudioBuffer<float>{channels, size};
+    for (auto ch{0}; ch < channels; ++ch)
+    {
+        auto* samples = buffer.getWritePointer(ch);
+        std::generate(samples, samples + size, [&] { return dist(rng); });
+    }
+    return buffer;
+}
+
+// OverlapAddProcessor as it was before the mirrored input staging. Every
+// hop pushes hopSize samples into a CircularBuffer per channel and copies
+// the whole block out of it, then adds the block into an output ring.
+template<typename FloatType, typename ProcessorType>
+struct RingCopyOverlapAddProcessor
+{
+    RingCopyOverlapAddProcessor(std::uint32_t blockSize, std::uint32_t hopSize)
+        : _blockSize{blockSize}, _hopSize{hopSize}
+    {
+    }
+
+    auto prepare(juce::dsp::ProcessSpec const& spec) -> void
+    {
+        _inputBuffers.assign(spec.numChannels, lt::CircularBuffer<FloatType>{_blockSize});
+        _outputBuffers.assign(spec.numChannels, lt::CircularBuffer<FloatType>{_blockSize});
+        _processBuffer.setSize(static_cast<int>(spec.numChannels), static_cast<int>(_blockSize), false, true);
+        _processor.prepare(spec);
+    }
+
+    template<typename ProcessContext>
+    auto process(ProcessContext const& context) -> void
+    {
+        auto inBlock  = context.getInputBlock();
+        auto outBlock = context.getOutputBlock();
+
+        auto const numSamples = static_cast<std::uint32_t>(inBlock.getNumSamples());
+        for (auto processed{0U}; processed < numSamples;)
+        {
+            auto const count = std::min(numSamples - processed, _hopSize - _samplesSinceLastHop);
+            for (auto ch{0U}; ch < inBlock.getNumChannels(); ++ch)
+            {
+                auto const* in = std::next(inBlock.getChannelPointer(ch), processed);
+                std::copy(in, std::next(in, count), std::back_inserter(_inputBuffers[ch]));
+
+                auto out = std::cbegin(_outputBuffers[ch]);
+                std::copy(out, std::next(out, count), std::next(outBlock.getChannelPointer(ch), processed));
+            }
+
+            processed += count;
+            _samplesSinceLastHop += count;
+            if (_samplesSinceLastHop == _hopSize)
+            {
+                _samplesSinceLastHop = 0;
+                processWrapped();
+            }
+        }
+    }
+
+private:
+    auto processWrapped() -> void
+    {
+        for (auto ch{0U}; ch < std::size(_inputBuffers); ++ch)
+        {
+            auto const& input = _inputBuffers[ch];
+            std::copy(std::cbegin(input), std::cend(input), _processBuffer.getWritePointer(static_cast<int>(ch)));
+        }
+
+        auto block = juce::dsp::AudioBlock<FloatType>(_processBuffer);
+        _processor.process(juce::dsp::ProcessContextReplacing<FloatType>(block));
+        block.multiplyBy(static_cast<FloatType>(_hopSize) / static_cast<FloatType>(_blockSize));
+
+        for (auto ch{0U}; ch < std::size(_outputBuffers); ++ch)
+        {
+            auto& out              = _outputBuffers[ch];
+            auto const* first      = _processBuffer.getReadPointer(static_cast<int>(ch));
+            auto const* last       = std::next(first, _blockSize);
+            auto const* firstOfNew = std::prev(last, _hopSize);
+            std::copy(firstOfNew, last, std::back_inserter(out));
+            std::transform(first, firstOfNew, std::begin(out), std::begin(out), std::plus<>{});
+        }
+    }
+
+    ProcessorType _processor;
+    std::vector<lt::CircularBuffer<FloatType>> _inputBuffers{};
+    std::vector<lt::CircularBuffer<FloatType>> _outputBuffers{};
+    juce::AudioBuffer<FloatType> _processBuffer{};
+    std::uint32_t _blockSize;
+    std::uint32_t _hopSize;
+    std::uint32_t _samplesSinceLastHop{0};
+};
+
+// The same passthrough configuration through the old and the new processor.
+template<template<typename, typename> typename Wrapper>
+static void lt_OverlapAddProcessor(benchmark::State& state)
+{
+    auto const windowSize = static_cast<std::uint32_t>(state.range(0));
+    auto const hopSize    = windowSize / static_cast<std::uint32_t>(state.range(1));
+    auto const spec       = juce::dsp::ProcessSpec{benchmarkSampleRate, static_cast<std::uint32_t>(benchmarkBlockSize),
+                                             static_cast<std::uint32_t>(benchmarkNumChannels)};
+
+    auto proc = Wrapper<float, BenchmarkPassthrough>{windowSize, hopSize};
+    proc.prepare(spec);
+
+    auto input    = generateSignal(benchmarkNumChannels, benchmarkBlockSize);
+    auto output   = juce::AudioBuffer<float>{benchmarkNumChannels, benchmarkBlockSize};
+    auto inBlock  = juce::dsp::AudioBlock<float const>{input};
+    auto outBlock = juce::dsp::AudioBlock<float>{output};
+
+    for (auto _ : state)
+    {
+        proc.process(juce::dsp::ProcessContextNonReplacing<float>{inBlock, outBlock});
+        benchmark::DoNotOptimize(output.getReadPointer(0));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * benchmarkBlockSize);
+}
+BENCHMARK_TEMPLATE(lt_OverlapAddProcessor, RingCopyOverlapAddProcessor)->ArgsProduct({{1024, 4096}, {2, 4, 8}});
+BENCHMARK_TEMPLATE(lt_OverlapAddProcessor, lt::OverlapAddProcessor)->ArgsProduct({{1024, 4096}, {2, 4, 8}});
+
+static void lt_OverlapAddProcessor_Spectral(benchmark::State& state)
+{
+    auto const windowSize = static_cast<std::uint32_t>(state.range(0));
+    auto const hopSize    = static_cast<std::uint32_t>(state.range(1));
+    auto const spec       = juce::dsp::ProcessSpec{benchmarkSampleRate, static_cast<std::uint32_t>(benchmarkBlockSize),
+                                             static_cast<std::uint32_t>(benchmarkNumChannels)};
+
+    auto proc = lt::OverlapAddProcessor<float, BenchmarkSpectralGain>{windowSize, hopSize};
+    proc.setAnalysisWindow(lt::WindowType::sqrtHann);
+    proc.setSynthesisWindow(lt::WindowType::sqrtHann);
+    proc.setBatching(state.range(2) != 0);
+    proc.prepare(spec);
+
+    // Separate output, processing in place would decay the signal into denormals.
+    auto input    = generateSignal(benchmarkNumChannels, benchmarkBlockSize);
+    auto output   = juce::AudioBuffer<float>{benchmarkNumChannels, benchmarkBlockSize};
+    auto inBlock  = juce::dsp::AudioBlock<float const>{input};
+    auto outBlock = juce::dsp::AudioBlock<float>{output};
+
+    for (auto _ : state)
+    {
+        proc.process(juce::dsp::ProcessContextNonReplacing<float>{inBlock, outBlock});
+        benchmark::DoNotOptimize(output.getReadPointer(0));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * benchmarkBlockSize);
+}
+BENCHMARK(lt_OverlapAddProcessor_Spectral)->ArgsProduct({{256, 1024}, {32, 64}, {0, 1}});
+
+static void lt_OverlapAddProcessor_WorkerThreads(benchmark::State& state)
+{
+    static constexpr auto const windowSize = 2048U;
+    static constexpr auto const hopSize    = 512U;
+
+    auto const numChannels = static_cast<std::uint32_t>(state.range(0));
+    auto const numWorkers  = static_cast<std::uint32_t>(state.range(1));
+    auto const spec
+        = juce::dsp::ProcessSpec{benchmarkSampleRate, static_cast<std::uint32_t>(benchmarkBlockSize), numChannels};
+
+    auto proc = lt::OverlapAddProcessor<float, BenchmarkSpectralGain>{windowSize, hopSize};
+    proc.setAnalysisWindow(lt::WindowType::sqrtHann);
+    proc.setSynthesisWindow(lt::WindowType::sqrtHann);
+    proc.setNumWorkerThreads(numWorkers);
+    proc.prepare(spec);
+
+    auto input    = generateSignal(static_cast<int>(numChannels), benchmarkBlockSize);
+    auto output   = juce::AudioBuffer<float>{static_cast<int>(numChannels), benchmarkBlockSize};
+    auto inBlock  = juce::dsp::AudioBlock<float const>{input};
+    auto outBlock = juce::dsp::AudioBlock<float>{output};
+
+    for (auto _ : state)
+    {
+        proc.process(juce::dsp::ProcessContextNonReplacing<float>{inBlock, outBlock});
+        benchmark::DoNotOptimize(output.getReadPointer(0));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * benchmarkBlockSize * numChannels);
+}
+BENCHMARK(lt_OverlapAddProcessor_WorkerThreads)->ArgsProduct({{16, 64}, {0, 1, 3}})->UseRealTime();
+
+template<template<typename, typename> typename Wrapper>
+static void lt_SpectralFilter(benchmark::State& state)
+{
+    auto const windowSize = static_cast<std::uint32_t>(state.range(0));
+    auto const hopSize    = windowSize / 2U;
+    auto const spec       = juce::dsp::ProcessSpec{benchmarkSampleRate, static_cast<std::uint32_t>(benchmarkBlockSize),
+                                             static_cast<std::uint32_t>(benchmarkNumChannels)};
+
+    auto proc = Wrapper<float, BenchmarkSpectralGain>{windowSize, hopSize};
+    proc.prepare(spec);
+
+    auto input    = generateSignal(benchmarkNumChannels, benchmarkBlockSize);
+    auto output   = juce::AudioBuffer<float>{benchmarkNumChannels, benchmarkBlockSize};
+    auto inBlock  = juce::dsp::AudioBlock<float const>{input};
+    auto outBlock = juce::dsp::AudioBlock<float>{output};
+
+    for (auto _ : state)
+    {
+        proc.process(juce::dsp::ProcessContextNonReplacing<float>{inBlock, outBlock});
+        benchmark::DoNotOptimize(output.getReadPointer(0));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * benchmarkBlockSize);
+}
+BENCHMARK_TEMPLATE(lt_SpectralFilter, lt::OverlapAddProcessor)->Arg(256)->Arg(1024)->Arg(4096);
+BENCHMARK_TEMPLATE(lt_SpectralFilter, lt::OverlapSaveProcessor)->Arg(256)->Arg(1024)->Arg(4096);
+
+static void lt_OverlapAddProcessor_2048_512(benchmark::State& state)
+{
+    auto const spec = juce::dsp::ProcessSpec{benchmarkSampleRate, static_cast<std::uint32_t>(benchmarkBlockSize),
+                                             static_cast<std::uint32_t>(benchmarkNumChannels)};
+
+    auto proc = lt::OverlapAddProcessor<float, BenchmarkPassthrough>{2048U, 512U};
+    proc.setAnalysisWindow(lt::WindowType::sqrtHann);
+    proc.setSynthesisWindow(lt::WindowType::sqrtHann);
+    proc.prepare(spec);
+
+    auto input    = generateSignal(benchmarkNumChannels, benchmarkBlockSize);
+    auto output   = juce::AudioBuffer<float>{benchmarkNumChannels, benchmarkBlockSize};
+    auto inBlock  = juce::dsp::AudioBlock<float const>{input};
+    auto outBlock = juce::dsp::AudioBlock<float>{output};
+
+    for (auto _ : state)
+    {
+        proc.process(juce::dsp::ProcessContextNonReplacing<float>{inBlock, outBlock});
+        benchmark::DoNotOptimize(output.getReadPointer(0));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * benchmarkBlockSize);
+}
+BENCHMARK(lt_OverlapAddProcessor_2048_512);
+
+// Both variants spend most of their time in FloatVectorOperations, so only
+// compare them in a build against the real JUCE modules.
+static void lt_StaticOverlapAddProcessor_2048_512(benchmark::State& state)
+{
+    using Processor = lt::StaticOverlapAddProcessor<float, BenchmarkPassthrough, 2048U, 512U, 2U>;
+
+    auto const spec = juce::dsp::ProcessSpec{benchmarkSampleRate, static_cast<std::uint32_t>(benchmarkBlockSize),
+                                             static_cast<std::uint32_t>(benchmarkNumChannels)};
+
+    auto proc = std::make_unique<Processor>();
+    proc->setAnalysisWindow(lt::WindowType::sqrtHann);
+    proc->setSynthesisWindow(lt::WindowType::sqrtHann);
+    proc->prepare(spec);
+
+    auto input    = generateSignal(benchmarkNumChannels, benchmarkBlockSize);
+    auto output   = juce::AudioBuffer<float>{benchmarkNumChannels, benchmarkBlockSize};
+    auto inBlock  = juce::dsp::AudioBlock<float const>{input};
+    auto outBlock = juce::dsp::AudioBlock<float>{output};
+
+    for (auto _ : state)
+    {
+        proc->process(juce::dsp::ProcessContextNonReplacing<float>{inBlock, outBlock});
+        benchmark::DoNotOptimize(output.getReadPointer(0));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * benchmarkBlockSize);
+}
+BENCHMARK(lt_StaticOverlapAddProcessor_2048_512);
\ No newline at end of file
@@ -23,7 +23,39 @@ namespace lt
 ///
 /// \details Useful for FFT-based effects that require a constant
 /// window size, often much larger than the audio interface block
-/// size used by the system. The latency is equal to the hop size.
+/// size used by the system. The latency is equal to the block size.
+///
+/// The input of every block is multiplied by the analysis window while
+/// it is copied, and the output by the synthesis window while it is
+/// accumulated. Both default to rectangular. The gain that makes the
+/// overlapped windows sum to one is folded into the synthesis table.
+///
+/// Incoming samples are staged in a MirroredCircularBuffer, so the most
+/// recent block is always one contiguous range. A hop only writes
+/// hopSize new samples per channel, the analysis pass then reads the
+/// block with a single vectorized multiply. The output is accumulated
+/// into a CircularBuffer of one block through its two segments, and
+/// samples are cleared as soon as they have been read.
+///
+/// If the processor satisfies SpectralProcessor, the wrapper runs the
+/// transforms itself. There is one pffft setup shared by all channels,
+/// and the processor is handed the bins in place. The 1/N scale of the
+/// inverse transform is folded into the synthesis table.
+///
+/// With batching enabled, all hops that complete during one call to
+/// process are handled together. Their frames are gathered into one
+/// contiguous buffer and processed back to back, then the output is
+/// accumulated frame by frame while it is read. The result is bit
+/// identical to the per-hop path and the latency is unchanged.
+///
+/// Spectral processors can also be spread over a ForkJoinPool. The
+/// channels are split into one group per thread, and the audio thread
+/// works on the first group. All groups use the same transform, whose
+/// work memory is per thread and reserved on every worker by prepare()
+/// and setNumWorkerThreads(). Every channel's buffers start on their
+/// own cache line. processSpectrum is then called concurrently for
+/// different channels, so the processor must not share mutable state
+/// between channels.
 template<typename FloatType, typename ProcessorType>
 struct OverlapAddProcessor
 {
@@ -34,33 +66,102 @@ struct OverlapAddProcessor
 
     auto prepare(juce::dsp::ProcessSpec const& spec) -> void;
 
+    /// \brief Reserves the transform work memory on the calling thread.
+    /// prepare() and setNumWorkerThreads() do it on their own thread and on
+    /// every worker, call this once on the audio thread before the first
+    /// process() if they ran on a different one.
+    auto reserveScratch() const -> void;
+
     template<typename ProcessContext>
     auto process(ProcessContext const& context) -> void;
 
     auto reset() -> void;
 
+    auto setAnalysisWindow(WindowType type, FloatType kaiserBeta = FloatType(8)) -> void;
+    auto setAnalysisWindow(Span<FloatType const> window) -> void;
+
+    auto setSynthesisWindow(WindowType type, FloatType kaiserBeta = FloatType(8)) -> void;
+    auto setSynthesisWindow(Span<FloatType const> window) -> void;
+
+    /// \brief Enables processing all hops of one callback as a batch.
+    /// Allocates in prepare. When enabled after prepare, callbacks that
+    /// complete more than one hop use the per-hop path until the next
+    /// prepare.
+    auto setBatching(bool shouldBatch) -> void;
+    [[nodiscard]] auto isBatching() const noexcept -> bool;
+
+    /// \brief Number of threads helping the audio thread, 0 disables it.
+    /// Starts realtime threads, must not be called from the audio thread.
+    auto setNumWorkerThreads(std::uint32_t numWorkers) -> void
+        requires SpectralProcessor<ProcessorType, FloatType>;
+    [[nodiscard]] auto numWorkerThreads() const noexcept -> std::uint32_t;
+
+    [[nodiscard]] auto analysisWindow() const noexcept -> Span<FloatType const>;
+    [[nodiscard]] auto synthesisWindow() const noexcept -> Span<FloatType const>;
+
     [[nodiscard]] auto processor() noexcept -> ProcessorType&;
     [[nodiscard]] auto processor() const noexcept -> ProcessorType const&;
 
 private:
+    auto pushInput(std::uint32_t channel, FloatType const* samples, std::uint32_t numSamples) -> void;
+    auto popOutput(std::uint32_t channel, FloatType* samples, std::uint32_t numSamples) -> void;
     auto processWrapped() -> void;
+    auto processFrames(std::uint32_t numFrames) -> void;
+    auto processSpectra(std::uint32_t numFrames, std::uint32_t group) -> void;
+    auto reserveScratchOnWorkers() -> void;
+    [[nodiscard]] auto numGroups() const noexcept -> std::uint32_t;
+    [[nodiscard]] auto firstChannel(std::uint32_t group) const noexcept -> std::uint32_t;
+    auto frame(std::uint32_t index, std::uint32_t channel) -> FloatType*;
+    auto advance(std::uint32_t numSamples) -> bool;
+
+    template<typename InBlock, typename OutBlock>
+    auto processBatch(InBlock const& inBlock, OutBlock& outBlock) -> void;
+
+    auto analyze(std::uint32_t channel, FloatType* frame) -> void;
+    auto accumulate(std::uint32_t channel, FloatType const* frame) -> void;
+    auto updateSynthesisTable() -> void;
+
+    static constexpr auto isSpectral = SpectralProcessor<ProcessorType, FloatType>;
 
     ProcessorType _processor;
 
-    std::vector<CircularBuffer<value_type>> _inputBuffers{};
+    std::vector<MirroredCircularBuffer<value_type>> _inputBuffers{};
     std::vector<CircularBuffer<value_type>> _outputBuffers{};
     juce::AudioBuffer<value_type> _processBuffer{};
 
+    std::unique_ptr<ForkJoinPool> _pool{};
+    std::unique_ptr<pffft::Fft<value_type>> _fft{};
+    pffft::AlignedVector<value_type> _frames{};
+    pffft::AlignedVector<value_type> _spectra{};
+
+    pffft::AlignedVector<value_type> _analysisWindow{};
+    pffft::AlignedVector<value_type> _synthesisWindow{};
+    pffft::AlignedVector<value_type> _synthesisTable{};
+
     std::uint32_t _blockSize;
     std::uint32_t _hopSize;
     std::uint32_t _samplesSinceLastHop{0};
+    std::uint32_t _numChannels{0};
+    std::uint32_t _maxFrames{1};
+    bool _batching{false};
 };
 
 template<typename FloatType, typename ProcessorType>
 OverlapAddProcessor<FloatType, ProcessorType>::OverlapAddProcessor(std::uint32_t blockSize, std::uint32_t hopSize)
-    : _blockSize{blockSize}, _hopSize{hopSize}
+    : _analysisWindow(blockSize, FloatType(1))
+    , _synthesisWindow(blockSize, FloatType(1))
+    , _synthesisTable(blockSize, FloatType(1))
+    , _blockSize{blockSize}
+    , _hopSize{hopSize}
 {
     jassert(hopSize < blockSize);
+
+    if constexpr (isSpectral)
+    {
+        _fft = std::make_unique<pffft::Fft<value_type>>(signCast<int>(blockSize));
+        jassert(_fft->isValid());
+    }
+    updateSynthesisTable();
 }
 
 template<typename FloatType, typename ProcessorType>
@@ -68,14 +169,35 @@ auto OverlapAddProcessor<FloatType, ProcessorType>::prepare(juce::dsp::ProcessSp
 {
     _inputBuffers.resize(spec.numChannels);
     _outputBuffers.resize(spec.numChannels);
-    for (auto& buffer : _inputBuffers) { buffer.resize(_blockSize); }
-    for (auto& buffer : _outputBuffers) { buffer.resize(_blockSize); }
+    for (auto& buffer : _inputBuffers) { buffer = MirroredCircularBuffer<value_type>{_blockSize}; }
+    for (auto& buffer : _outputBuffers) { buffer = CircularBuffer<value_type>{_blockSize}; }
 
     auto blockSpec             = spec;
     blockSpec.maximumBlockSize = _blockSize;
     _processor.prepare(blockSpec);
 
-    _processBuffer.setSize(signCast<int>(spec.numChannels), signCast<int>(_blockSize), false, true);
+    // A callback of maximumBlockSize samples completes at most this many hops.
+    _numChannels = spec.numChannels;
+    _maxFrames   = _batching ? std::max(1U, (spec.maximumBlockSize + _hopSize - 1U) / _hopSize) : 1U;
+
+    auto const frameSize = static_cast<std::size_t>(_maxFrames) * _blockSize;
+    if constexpr (isSpectral)
+    {
+        _frames.assign(frameSize * _numChannels, FloatType{});
+        _spectra.assign(frameSize * _numChannels, FloatType{});
+    }
+    else
+    {
+        _processBuffer.setSize(signCast<int>(_numChannels), signCast<int>(frameSize), false, true);
+    }
+
+    reserveScratchOnWorkers();
+}
+
+template<typename FloatType, typename ProcessorType>
+auto OverlapAddProcessor<FloatType, ProcessorType>::reserveScratch() const -> void
+{
+    if constexpr (isSpectral) { _fft->reserveScratch(); }
 }
 
 template<typename FloatType, typename ProcessorType>
@@ -90,6 +212,15 @@ auto OverlapAddProcessor<FloatType, ProcessorType>::process(ProcessContext const
     jassert(inBlock.getNumChannels() == outBlock.getNumChannels());
     jassert(inBlock.getNumSamples() == outBlock.getNumSamples());
 
+    // The batch needs a frame for every hop that completes in this callback.
+    // There is only room for one if batching was enabled after prepare().
+    auto const numHops = (_samplesSinceLastHop + inBlock.getNumSamples()) / _hopSize;
+    if (_batching && numHops <= _maxFrames)
+    {
+        processBatch(inBlock, outBlock);
+        return;
+    }
+
     auto const numSamples  = signCast<int>(inBlock.getNumSamples());
     auto const numChannels = inBlock.getNumChannels();
 
@@ -105,23 +236,15 @@ auto OverlapAddProcessor<FloatType, ProcessorType>::process(ProcessContext const
         {
             // Copy input buffer to queue
             auto inF = std::next(inBlock.getChannelPointer(ch), numSamplesProcessed);
-            auto inL = std::next(inF, numSamplesToProcess);
-            std::copy(inF, inL, std::back_inserter(_inputBuffers[ch]));
+            pushInput(ch, inF, signCast<std::uint32_t>(numSamplesToProcess));
 
             // Copy output buffer from queue
-            auto outF = std::begin(_outputBuffers[ch]);
-            auto outL = std::next(outF, numSamplesToProcess);
-            std::copy(outF, outL, std::next(outBlock.getChannelPointer(ch), numSamplesProcessed));
+            auto outF = std::next(outBlock.getChannelPointer(ch), numSamplesProcessed);
+            popOutput(ch, outF, signCast<std::uint32_t>(numSamplesToProcess));
         }
 
         numSamplesProcessed += numSamplesToProcess;
-        _samplesSinceLastHop += signCast<std::uint32_t>(numSamplesToProcess);
-
-        if (_samplesSinceLastHop == _hopSize)
-        {
-            _samplesSinceLastHop = 0;
-            processWrapped();
-        }
+        if (advance(signCast<std::uint32_t>(numSamplesToProcess))) { processWrapped(); }
     }
 }
 
@@ -129,6 +252,78 @@ template<typename FloatType, typename ProcessorType>
 auto OverlapAddProcessor<FloatType, ProcessorType>::reset() -> void
 {
     _processor.reset();
+
+    for (auto& buffer : _inputBuffers) { std::fill(std::begin(buffer), std::end(buffer), FloatType{}); }
+    for (auto& buffer : _outputBuffers) { std::fill(std::begin(buffer), std::end(buffer), FloatType{}); }
+    _samplesSinceLastHop = 0;
+}
+
+template<typename FloatType, typename ProcessorType>
+auto OverlapAddProcessor<FloatType, ProcessorType>::setAnalysisWindow(WindowType type, FloatType kaiserBeta) -> void
+{
+    fillWindow(Span<FloatType>{_analysisWindow}, type, kaiserBeta);
+    updateSynthesisTable();
+}
+
+template<typename FloatType, typename ProcessorType>
+auto OverlapAddProcessor<FloatType, ProcessorType>::setAnalysisWindow(Span<FloatType const> window) -> void
+{
+    jassert(std::size(window) == _blockSize);
+    std::copy(std::begin(window), std::end(window), std::begin(_analysisWindow));
+    updateSynthesisTable();
+}
+
+template<typename FloatType, typename ProcessorType>
+auto OverlapAddProcessor<FloatType, ProcessorType>::setSynthesisWindow(WindowType type, FloatType kaiserBeta) -> void
+{
+    fillWindow(Span<FloatType>{_synthesisWindow}, type, kaiserBeta);
+    updateSynthesisTable();
+}
+
+template<typename FloatType, typename ProcessorType>
+auto OverlapAddProcessor<FloatType, ProcessorType>::setSynthesisWindow(Span<FloatType const> window) -> void
+{
+    jassert(std::size(window) == _blockSize);
+    std::copy(std::begin(window), std::end(window), std::begin(_synthesisWindow));
+    updateSynthesisTable();
+}
+
+template<typename FloatType, typename ProcessorType>
+auto OverlapAddProcessor<FloatType, ProcessorType>::setBatching(bool shouldBatch) -> void
+{
+    _batching = shouldBatch;
+}
+
+template<typename FloatType, typename ProcessorType>
+auto OverlapAddProcessor<FloatType, ProcessorType>::isBatching() const noexcept -> bool
+{
+    return _batching;
+}
+
+template<typename FloatType, typename ProcessorType>
+auto OverlapAddProcessor<FloatType, ProcessorType>::setNumWorkerThreads(std::uint32_t numWorkers) -> void
+    requires SpectralProcessor<ProcessorType, FloatType>
+{
+    _pool = numWorkers > 0U ? std::make_unique<ForkJoinPool>(numWorkers) : nullptr;
+    reserveScratchOnWorkers();
+}
+
+template<typename FloatType, typename ProcessorType>
+auto OverlapAddProcessor<FloatType, ProcessorType>::numWorkerThreads() const noexcept -> std::uint32_t
+{
+    return _pool != nullptr ? _pool->numWorkers() : 0U;
+}
+
+template<typename FloatType, typename ProcessorType>
+auto OverlapAddProcessor<FloatType, ProcessorType>::analysisWindow() const noexcept -> Span<FloatType const>
+{
+    return Span<FloatType const>{_analysisWindow};
+}
+
+template<typename FloatType, typename ProcessorType>
+auto OverlapAddProcessor<FloatType, ProcessorType>::synthesisWindow() const noexcept -> Span<FloatType const>
+{
+    return Span<FloatType const>{_synthesisWindow};
 }
 
 template<typename FloatType, typename ProcessorType>
@@ -143,34 +338,262 @@ auto OverlapAddProcessor<FloatType, ProcessorType>::processor() const noexcept -
     return _processor;
 }
 
+template<typename FloatType, typename ProcessorType>
+auto OverlapAddProcessor<FloatType, ProcessorType>::pushInput(std::uint32_t channel, FloatType const* samples,
+                                                              std::uint32_t numSamples) -> void
+{
+    jassert(numSamples <= _blockSize);
+    _inputBuffers[channel].write(Span<FloatType const>{samples, numSamples});
+}
+
+template<typename FloatType, typename ProcessorType>
+auto OverlapAddProcessor<FloatType, ProcessorType>::popOutput(std::uint32_t channel, FloatType* samples,
+                                                              std::uint32_t numSamples) -> void
+{
+    jassert(_samplesSinceLastHop + numSamples <= _hopSize);
+
+    // Finished samples are the oldest in the ring, reading clears them
+    // for the frame that ends there.
+    _outputBuffers[channel].read(Span<FloatType>{samples, numSamples});
+}
+
+template<typename FloatType, typename ProcessorType>
+template<typename InBlock, typename OutBlock>
+auto OverlapAddProcessor<FloatType, ProcessorType>::processBatch(InBlock const& inBlock, OutBlock& outBlock) -> void
+{
+    auto const numSamples          = narrowCast<std::uint32_t>(inBlock.getNumSamples());
+    auto const numChannels         = narrowCast<std::uint32_t>(inBlock.getNumChannels());
+    auto const samplesSinceLastHop = _samplesSinceLastHop;
+
+    // Queue the whole input and window the frame of every completed hop.
+    auto numFrames = 0U;
+    for (auto first{0U}; first < numSamples;)
+    {
+        auto const count = std::min(numSamples - first, _hopSize - _samplesSinceLastHop);
+        for (auto ch{0U}; ch < numChannels; ++ch)
+        {
+            pushInput(ch, std::next(inBlock.getChannelPointer(ch), first), count);
+        }
+
+        first += count;
+        if (advance(count))
+        {
+            jassert(numFrames < _maxFrames);
+            for (auto ch{0U}; ch < numChannels; ++ch) { analyze(ch, frame(numFrames, ch)); }
+            ++numFrames;
+        }
+    }
+
+    processFrames(numFrames);
+
+    // Replay the hop boundaries of this callback, so every output sample
+    // sees the same sequence of additions as on the per-hop path.
+    _samplesSinceLastHop = samplesSinceLastHop;
+    auto frameIndex      = 0U;
+    for (auto first{0U}; first < numSamples;)
+    {
+        auto const count = std::min(numSamples - first, _hopSize - _samplesSinceLastHop);
+        for (auto ch{0U}; ch < numChannels; ++ch)
+        {
+            popOutput(ch, std::next(outBlock.getChannelPointer(ch), first), count);
+        }
+
+        first += count;
+        if (advance(count))
+        {
+            for (auto ch{0U}; ch < numChannels; ++ch) { accumulate(ch, frame(frameIndex, ch)); }
+            ++frameIndex;
+        }
+    }
+}
+
+template<typename FloatType, typename ProcessorType>
+auto OverlapAddProcessor<FloatType, ProcessorType>::advance(std::uint32_t numSamples) -> bool
+{
+    _samplesSinceLastHop += numSamples;
+    if (_samplesSinceLastHop < _hopSize) { return false; }
+
+    _samplesSinceLastHop = 0;
+    return true;
+}
+
 template<typename FloatType, typename ProcessorType>
 auto OverlapAddProcessor<FloatType, ProcessorType>::processWrapped() -> void
 {
     jassert(std::size(_outputBuffers) == std::size(_inputBuffers));
 
-    for (auto ch{0U}; ch < std::size(_inputBuffers); ++ch)
+    if constexpr (isSpectral)
     {
-        auto const& input = _inputBuffers[ch];
-        std::copy(std::cbegin(input), std::cend(input), _processBuffer.getWritePointer(signCast<int>(ch)));
+        if (_pool != nullptr)
+        {
+            // One fork/join per hop, every group runs its channels end to end.
+            _pool->run(numGroups(), [this](std::uint32_t group) {
+                auto const first = firstChannel(group);
+                auto const last  = firstChannel(group + 1U);
+                for (auto ch{first}; ch < last; ++ch) { analyze(ch, frame(0, ch)); }
+                processSpectra(1, group);
+                for (auto ch{first}; ch < last; ++ch) { accumulate(ch, frame(0, ch)); }
+            });
+            return;
+        }
     }
 
-    auto block = juce::dsp::AudioBlock<value_type>(_processBuffer);
-    auto ctx   = juce::dsp::ProcessContextReplacing<value_type>(block);
-    _processor.process(ctx);
+    for (auto ch{0U}; ch < _numChannels; ++ch) { analyze(ch, frame(0, ch)); }
+    processFrames(1);
+    for (auto ch{0U}; ch < _numChannels; ++ch) { accumulate(ch, frame(0, ch)); }
+}
 
-    auto const gain = static_cast<value_type>(_hopSize) / static_cast<value_type>(_blockSize);
-    block.multiplyBy(gain);
+template<typename FloatType, typename ProcessorType>
+auto OverlapAddProcessor<FloatType, ProcessorType>::processFrames(std::uint32_t numFrames) -> void
+{
+    if constexpr (isSpectral)
+    {
+        if (_pool != nullptr)
+        {
+            _pool->run(numGroups(), [this, numFrames](std::uint32_t group) { processSpectra(numFrames, group); });
+        }
+        else
+        {
+            processSpectra(numFrames, 0);
+        }
+    }
+    else
+    {
+        auto block = juce::dsp::AudioBlock<value_type>(_processBuffer);
+        for (auto i{0U}; i < numFrames; ++i)
+        {
+            auto subBlock = block.getSubBlock(static_cast<std::size_t>(i) * _blockSize, _blockSize);
+            _processor.process(juce::dsp::ProcessContextReplacing<value_type>(subBlock));
+        }
+    }
+}
 
-    for (auto ch{0U}; ch < std::size(_outputBuffers); ++ch)
+template<typename FloatType, typename ProcessorType>
+auto OverlapAddProcessor<FloatType, ProcessorType>::processSpectra(std::uint32_t numFrames, std::uint32_t group)
+    -> void
+{
+    static constexpr auto const layout = ProcessorType::spectrumLayout;
+    using BinType                      = SpectrumValueType<value_type, layout>;
+
+    auto& fft          = *_fft;
+    auto const first   = firstChannel(group);
+    auto const last    = firstChannel(group + 1U);
+    auto const numBins = _blockSize * sizeof(value_type) / sizeof(BinType);
+    auto spectrum      = [this](std::uint32_t index, std::uint32_t channel) {
+        return _spectra.data() + (static_cast<std::size_t>(index) * _numChannels + channel) * _blockSize;
+    };
+
+    // All transforms run back to back, only the processor is called in between.
+    for (auto i{0U}; i < numFrames; ++i)
     {
-        auto& out = _outputBuffers[ch];
+        for (auto ch{first}; ch < last; ++ch)
+        {
+            if constexpr (layout == SpectrumLayout::ordered)
+            {
+                fft.forward(frame(i, ch), reinterpret_cast<BinType*>(spectrum(i, ch)));
+            }
+            else
+            {
+                fft.forwardToInternalLayout(frame(i, ch), spectrum(i, ch));
+            }
+        }
+    }
 
-        auto const* pFirst   = _processBuffer.getReadPointer(signCast<int>(ch));
-        auto const* pLast    = pFirst + _processBuffer.getNumSamples();
-        auto const pFirstNew = std::prev(pLast, _hopSize);
-        std::copy(pFirstNew, pLast, std::back_inserter(out));
-        std::transform(pFirst, pFirstNew, std::begin(out), std::begin(out), std::plus<>{});
+    for (auto i{0U}; i < numFrames; ++i)
+    {
+        for (auto ch{first}; ch < last; ++ch)
+        {
+            _processor.processSpectrum(ch, Span<BinType>{reinterpret_cast<BinType*>(spectrum(i, ch)), numBins});
+        }
+    }
+
+    for (auto i{0U}; i < numFrames; ++i)
+    {
+        for (auto ch{first}; ch < last; ++ch)
+        {
+            if constexpr (layout == SpectrumLayout::ordered)
+            {
+                fft.inverse(reinterpret_cast<BinType const*>(spectrum(i, ch)), frame(i, ch));
+            }
+            else
+            {
+                fft.inverseFromInternalLayout(spectrum(i, ch), frame(i, ch));
+            }
+        }
+    }
+}
+
+template<typename FloatType, typename ProcessorType>
+auto OverlapAddProcessor<FloatType, ProcessorType>::reserveScratchOnWorkers() -> void
+{
+    if (_pool == nullptr)
+    {
+        reserveScratch();
+        return;
+    }
+
+    // The calling thread takes part in the run as well.
+    _pool->runOnEachThread([this] { reserveScratch(); });
+}
+
+template<typename FloatType, typename ProcessorType>
+auto OverlapAddProcessor<FloatType, ProcessorType>::numGroups() const noexcept -> std::uint32_t
+{
+    if (_pool == nullptr) { return 1U; }
+    return std::max(1U, std::min(_numChannels, _pool->numWorkers() + 1U));
+}
+
+template<typename FloatType, typename ProcessorType>
+auto OverlapAddProcessor<FloatType, ProcessorType>::firstChannel(std::uint32_t group) const noexcept -> std::uint32_t
+{
+    return group * _numChannels / numGroups();
+}
+
+template<typename FloatType, typename ProcessorType>
+auto OverlapAddProcessor<FloatType, ProcessorType>::frame(std::uint32_t index, std::uint32_t channel) -> FloatType*
+{
+    if constexpr (isSpectral)
+    {
+        // Frames of the same hop are adjacent, one block per channel.
+        auto const offset = (static_cast<std::size_t>(index) * _numChannels + channel) * _blockSize;
+        return _frames.data() + offset;
     }
+    else
+    {
+        auto const offset = static_cast<std::size_t>(index) * _blockSize;
+        return _processBuffer.getWritePointer(signCast<int>(channel)) + offset;
+    }
+}
+
+template<typename FloatType, typename ProcessorType>
+auto OverlapAddProcessor<FloatType, ProcessorType>::analyze(std::uint32_t channel, FloatType* frame) -> void
+{
+    auto const* input = _inputBuffers[channel].data();
+    juce::FloatVectorOperations::multiply(frame, input, _analysisWindow.data(), signCast<int>(_blockSize));
+}
+
+template<typename FloatType, typename ProcessorType>
+auto OverlapAddProcessor<FloatType, ProcessorType>::accumulate(std::uint32_t channel, FloatType const* frame) -> void
+{
+    auto const* synthesis = _synthesisTable.data();
+    forEachSegment(_outputBuffers[channel].segments(), [=](Span<FloatType> out, std::size_t offset) {
+        juce::FloatVectorOperations::addWithMultiply(std::data(out), std::next(frame, offset),
+                                                     std::next(synthesis, offset), signCast<int>(std::size(out)));
+    });
+}
+
+template<typename FloatType, typename ProcessorType>
+auto OverlapAddProcessor<FloatType, ProcessorType>::updateSynthesisTable() -> void
+{
+    auto const analysis  = Span<FloatType const>{_analysisWindow};
+    auto const synthesis = Span<FloatType const>{_synthesisWindow};
+    auto gain            = overlapAddGain(analysis, synthesis, _hopSize);
+
+    // The inverse transform is unscaled.
+    if constexpr (isSpectral) { gain /= static_cast<FloatType>(_blockSize); }
+
+    std::transform(std::cbegin(synthesis), std::cend(synthesis), std::begin(_synthesisTable),
+                   [gain](auto w) { return w * gain; });
 }
 
 }  // namespace lt
\ No newline at end of file
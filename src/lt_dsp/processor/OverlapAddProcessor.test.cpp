@@ -1,5 +1,6 @@
 #include <lt_dsp/lt_dsp.hpp>
 
+#include "catch2/catch_approx.hpp"
 #include "catch2/catch_template_test_macros.hpp"
 #include "catch2/catch_test_macros.hpp"
 
@@ -55,7 +56,6 @@ struct PassthroughProcessor
         REQUIRE(inBlock.getNumSamples() == outBlock.getNumSamples());
 
         if (ProcessContext::usesSeparateInputAndOutputBlocks()) { outBlock.copyFrom(inBlock); }
-        std::cout << "passthrough: " << outBlock << '\n';
     }
 
     auto reset() -> void {}
@@ -120,4 +120,288 @@ TEMPLATE_TEST_CASE("dsp/processor: OverlapAddProcessor - overlap", "[dsp][proces
         // auto l = std::next(f, lt::signCast<long>(subBlock.getNumSamples()));
         // REQUIRE(std::all_of(f, l, [](auto s) { return (s == TestType{0}) || (s == TestType{1}); }));
     }
+}
+
+TEMPLATE_TEST_CASE("dsp/processor: OverlapAddProcessor - windowed", "[dsp][processor]", float, double)
+{
+    static constexpr auto const windowSize     = 64U;
+    static constexpr auto const hopSize        = 16U;
+    static constexpr auto const audioBlockSize = 24U;
+    static constexpr auto const numSamples     = 480U;
+
+    // Pairs whose product is constant overlap-add at a quarter of the window size.
+    using Pair                       = std::pair<lt::WindowType, lt::WindowType>;
+    auto const [analysis, synthesis] = GENERATE(Pair{lt::WindowType::rectangular, lt::WindowType::rectangular},
+                                                Pair{lt::WindowType::hann, lt::WindowType::rectangular},
+                                                Pair{lt::WindowType::rectangular, lt::WindowType::hann},
+                                                Pair{lt::WindowType::sqrtHann, lt::WindowType::sqrtHann});
+
+    auto proc = lt::OverlapAddProcessor<TestType, PassthroughProcessor>{windowSize, hopSize};
+    proc.setAnalysisWindow(analysis);
+    proc.setSynthesisWindow(synthesis);
+    proc.prepare(juce::dsp::ProcessSpec{44100.0, audioBlockSize, 1U});
+
+    auto buffer = juce::AudioBuffer<TestType>{1, lt::signCast<int>(numSamples)};
+    std::fill(buffer.getWritePointer(0), buffer.getWritePointer(0) + numSamples, TestType{1});
+
+    auto block = juce::dsp::AudioBlock<TestType>{buffer};
+    for (auto i{0U}; i < numSamples; i += audioBlockSize)
+    {
+        auto subBlock = block.getSubBlock(i, audioBlockSize);
+        proc.process(juce::dsp::ProcessContextReplacing<TestType>{subBlock});
+    }
+
+    // Once every output sample is covered by the full number of frames,
+    // the overlapped windows have to sum to one.
+    auto const* out = buffer.getReadPointer(0);
+    for (auto i{windowSize + hopSize}; i < numSamples; ++i) { REQUIRE(out[i] == Catch::Approx(1.0).margin(1e-4)); }
+}
+
+TEMPLATE_TEST_CASE("dsp/processor: OverlapAddProcessor - uneven blocks", "[dsp][processor]", float, double)
+{
+    static constexpr auto const windowSize = 16U;
+    static constexpr auto const hopSize    = 4U;
+    static constexpr auto const numSamples = 256U;
+
+    // Host blocks that do not line up with the hop size.
+    auto const audioBlockSize = GENERATE(1U, 3U, 7U, 19U);
+
+    auto proc = lt::OverlapAddProcessor<TestType, PassthroughProcessor>{windowSize, hopSize};
+    proc.prepare(juce::dsp::ProcessSpec{44100.0, audioBlockSize, 1U});
+
+    auto buffer = juce::AudioBuffer<TestType>{1, lt::signCast<int>(numSamples)};
+    auto* data  = buffer.getWritePointer(0);
+    for (auto i{0U}; i < numSamples; ++i) { data[i] = static_cast<TestType>(i + 1U); }
+
+    auto block = juce::dsp::AudioBlock<TestType>{buffer};
+    for (auto i{0U}; i < numSamples; i += audioBlockSize)
+    {
+        auto subBlock = block.getSubBlock(i, std::min(audioBlockSize, numSamples - i));
+        proc.process(juce::dsp::ProcessContextReplacing<TestType>{subBlock});
+    }
+
+    static constexpr auto const delay = windowSize;
+    for (auto i{0U}; i < numSamples; ++i)
+    {
+        auto const expected = i < delay ? TestType{0} : static_cast<TestType>(i + 1U - delay);
+        REQUIRE(data[i] == Catch::Approx(expected));
+    }
+}
+
+template<lt::SpectrumLayout Layout>
+struct SpectralGainProcessor
+{
+    static constexpr auto spectrumLayout = Layout;
+
+    auto prepare(juce::dsp::ProcessSpec const& s) -> void { spec = s; }
+
+    template<typename BinType>
+    auto processSpectrum(std::uint32_t channel, lt::Span<BinType> bins) -> void
+    {
+        REQUIRE(channel < spec.numChannels);
+        REQUIRE(std::size(bins) == (Layout == lt::SpectrumLayout::ordered ? spec.maximumBlockSize / 2U
+                                                                          : spec.maximumBlockSize));
+        for (auto& bin : bins) { bin *= gain; }
+    }
+
+    auto reset() -> void {}
+
+    float gain{1.0F};
+    juce::dsp::ProcessSpec spec{};
+};
+
+TEMPLATE_TEST_CASE("dsp/processor: OverlapAddProcessor - spectral", "[dsp][processor]", float, double)
+{
+    static constexpr auto const windowSize     = 64U;
+    static constexpr auto const hopSize        = 16U;
+    static constexpr auto const audioBlockSize = 24U;
+    static constexpr auto const numChannels    = 2U;
+    static constexpr auto const numSamples     = 480U;
+
+    using OrderedProcessor  = SpectralGainProcessor<lt::SpectrumLayout::ordered>;
+    using InternalProcessor = SpectralGainProcessor<lt::SpectrumLayout::internal>;
+
+    STATIC_REQUIRE(lt::SpectralProcessor<OrderedProcessor, TestType>);
+    STATIC_REQUIRE(lt::SpectralProcessor<InternalProcessor, TestType>);
+    STATIC_REQUIRE_FALSE(lt::SpectralProcessor<PassthroughProcessor, TestType>);
+
+    auto const gain = GENERATE(1.0F, 0.5F);
+
+    auto run = [gain](auto& proc) {
+        proc.processor().gain = gain;
+        proc.setAnalysisWindow(lt::WindowType::sqrtHann);
+        proc.setSynthesisWindow(lt::WindowType::sqrtHann);
+        proc.prepare(juce::dsp::ProcessSpec{44100.0, audioBlockSize, numChannels});
+        REQUIRE(proc.processor().spec == juce::dsp::ProcessSpec{44100.0, windowSize, numChannels});
+
+        auto buffer = juce::AudioBuffer<TestType>{int(numChannels), lt::signCast<int>(numSamples)};
+        for (auto ch{0}; ch < int(numChannels); ++ch)
+        {
+            auto* data = buffer.getWritePointer(ch);
+            for (auto i{0U}; i < numSamples; ++i) { data[i] = std::sin(TestType(0.05) * TestType(i) + TestType(ch)); }
+        }
+
+        auto block = juce::dsp::AudioBlock<TestType>{buffer};
+        for (auto i{0U}; i < numSamples; i += audioBlockSize)
+        {
+            auto subBlock = block.getSubBlock(i, audioBlockSize);
+            proc.process(juce::dsp::ProcessContextReplacing<TestType>{subBlock});
+        }
+
+        for (auto ch{0}; ch < int(numChannels); ++ch)
+        {
+            auto const* out = buffer.getReadPointer(ch);
+            for (auto i{2U * windowSize}; i < numSamples; ++i)
+            {
+                auto const expected = gain * std::sin(TestType(0.05) * TestType(i - windowSize) + TestType(ch));
+                REQUIRE(out[i] == Catch::Approx(expected).margin(1e-4));
+            }
+        }
+    };
+
+    SECTION("ordered")
+    {
+        auto proc = lt::OverlapAddProcessor<TestType, OrderedProcessor>{windowSize, hopSize};
+        run(proc);
+    }
+
+    SECTION("internal")
+    {
+        auto proc = lt::OverlapAddProcessor<TestType, InternalProcessor>{windowSize, hopSize};
+        run(proc);
+    }
+}
+
+template<typename Proc, typename T>
+static auto processOverlapAdd(Proc& proc, std::uint32_t audioBlockSize, std::uint32_t numSamples,
+                              std::uint32_t numChannels = 2U) -> std::vector<T>
+{
+
+    auto buffer = juce::AudioBuffer<T>{int(numChannels), lt::signCast<int>(numSamples)};
+    for (auto ch{0}; ch < int(numChannels); ++ch)
+    {
+        auto* data = buffer.getWritePointer(ch);
+        for (auto i{0U}; i < numSamples; ++i) { data[i] = std::sin(T(0.031) * T(i) * T(ch + 1)); }
+    }
+
+    auto block = juce::dsp::AudioBlock<T>{buffer};
+    for (auto i{0U}; i < numSamples; i += audioBlockSize)
+    {
+        auto subBlock = block.getSubBlock(i, std::min(audioBlockSize, numSamples - i));
+        proc.process(juce::dsp::ProcessContextReplacing<T>{subBlock});
+    }
+
+    auto out = std::vector<T>{};
+    for (auto ch{0}; ch < int(numChannels); ++ch)
+    {
+        std::copy(buffer.getReadPointer(ch), buffer.getReadPointer(ch) + numSamples, std::back_inserter(out));
+    }
+    return out;
+}
+
+template<typename Proc, typename T>
+static auto runOverlapAdd(Proc& proc, std::uint32_t audioBlockSize, std::uint32_t numSamples,
+                          std::uint32_t numChannels = 2U) -> std::vector<T>
+{
+    proc.setAnalysisWindow(lt::WindowType::sqrtHann);
+    proc.setSynthesisWindow(lt::WindowType::sqrtHann);
+    proc.prepare(juce::dsp::ProcessSpec{44100.0, audioBlockSize, numChannels});
+    return processOverlapAdd<Proc, T>(proc, audioBlockSize, numSamples, numChannels);
+}
+
+TEMPLATE_TEST_CASE("dsp/processor: OverlapAddProcessor - batching", "[dsp][processor]", float, double)
+{
+    static constexpr auto const windowSize = 64U;
+    static constexpr auto const hopSize    = 8U;
+    static constexpr auto const numSamples = 1024U;
+
+    auto const audioBlockSize = GENERATE(5U, 8U, 37U, 128U);
+
+    SECTION("time domain")
+    {
+        auto single  = lt::OverlapAddProcessor<TestType, PassthroughProcessor>{windowSize, hopSize};
+        auto batched = lt::OverlapAddProcessor<TestType, PassthroughProcessor>{windowSize, hopSize};
+        batched.setBatching(true);
+        REQUIRE(batched.isBatching());
+
+        auto const expected = runOverlapAdd<decltype(single), TestType>(single, audioBlockSize, numSamples);
+        auto const actual   = runOverlapAdd<decltype(batched), TestType>(batched, audioBlockSize, numSamples);
+        REQUIRE(actual == expected);
+    }
+
+    SECTION("spectral")
+    {
+        using Processor = SpectralGainProcessor<lt::SpectrumLayout::ordered>;
+
+        auto single  = lt::OverlapAddProcessor<TestType, Processor>{windowSize, hopSize};
+        auto batched = lt::OverlapAddProcessor<TestType, Processor>{windowSize, hopSize};
+        single.processor().gain  = 0.25F;
+        batched.processor().gain = 0.25F;
+        batched.setBatching(true);
+
+        auto const expected = runOverlapAdd<decltype(single), TestType>(single, audioBlockSize, numSamples);
+        auto const actual   = runOverlapAdd<decltype(batched), TestType>(batched, audioBlockSize, numSamples);
+        REQUIRE(actual == expected);
+    }
+
+    SECTION("enabled after prepare")
+    {
+        // prepare() made room for one frame only, callbacks with more hops
+        // take the per-hop path until the next prepare().
+        auto single  = lt::OverlapAddProcessor<TestType, PassthroughProcessor>{windowSize, hopSize};
+        auto batched = lt::OverlapAddProcessor<TestType, PassthroughProcessor>{windowSize, hopSize};
+        batched.setAnalysisWindow(lt::WindowType::sqrtHann);
+        batched.setSynthesisWindow(lt::WindowType::sqrtHann);
+        batched.prepare(juce::dsp::ProcessSpec{44100.0, audioBlockSize, 2U});
+        batched.setBatching(true);
+
+        auto const expected = runOverlapAdd<decltype(single), TestType>(single, audioBlockSize, numSamples);
+        auto const actual   = processOverlapAdd<decltype(batched), TestType>(batched, audioBlockSize, numSamples);
+        REQUIRE(actual == expected);
+    }
+}
+
+// Per channel state only, processSpectrum may run concurrently for different channels.
+struct SpectralTiltProcessor
+{
+    static constexpr auto spectrumLayout = lt::SpectrumLayout::ordered;
+
+    auto prepare(juce::dsp::ProcessSpec const& spec) -> void { hops.assign(spec.numChannels, 0U); }
+
+    template<typename BinType>
+    auto processSpectrum(std::uint32_t channel, lt::Span<BinType> bins) -> void
+    {
+        auto const gain = 1.0F / static_cast<float>(1U + channel + hops[channel]++ % 3U);
+        for (auto i{0U}; i < std::size(bins); ++i) { bins[i] *= gain / static_cast<float>(1U + i / 8U); }
+    }
+
+    auto reset() -> void {}
+
+    std::vector<std::uint32_t> hops{};
+};
+
+TEMPLATE_TEST_CASE("dsp/processor: OverlapAddProcessor - worker threads", "[dsp][processor]", float, double)
+{
+    static constexpr auto const windowSize  = 64U;
+    static constexpr auto const hopSize     = 16U;
+    static constexpr auto const numChannels = 8U;
+    static constexpr auto const numSamples  = 1024U;
+
+    auto const numWorkers     = GENERATE(1U, 3U, 9U);
+    auto const batching       = GENERATE(false, true);
+    auto const audioBlockSize = GENERATE(16U, 37U, 128U);
+
+    using Processor = lt::OverlapAddProcessor<TestType, SpectralTiltProcessor>;
+
+    auto serial = Processor{windowSize, hopSize};
+    serial.setBatching(batching);
+
+    auto parallel = Processor{windowSize, hopSize};
+    parallel.setBatching(batching);
+    parallel.setNumWorkerThreads(numWorkers);
+    REQUIRE(parallel.numWorkerThreads() == numWorkers);
+
+    auto const expected = runOverlapAdd<Processor, TestType>(serial, audioBlockSize, numSamples, numChannels);
+    auto const actual   = runOverlapAdd<Processor, TestType>(parallel, audioBlockSize, numSamples, numChannels);
+    REQUIRE(actual == expected);
 }
\ No newline at end of file
@@ -0,0 +1,241 @@
+#pragma once
+
+namespace lt
+{
+
+/// \brief Wraps any type of processor and calls its process function
+/// in fixed size blocks, keeping only the last hopSize output samples
+/// of every block.
+///
+/// \details Overlap-save counterpart to OverlapAddProcessor, meant for
+/// linear filtering. Each block holds the last blockSize input samples.
+/// A circular convolution with a filter of up to blockSize - hopSize + 1
+/// taps is only aliased in the first blockSize - hopSize samples, which
+/// are discarded. There are no windows and no output accumulation, the
+/// output is read straight from the tail of the processed block. The
+/// latency is equal to the hop size.
+///
+/// Spectral processors are supported the same way as in
+/// OverlapAddProcessor, the wrapper owns the transform and applies the
+/// 1/N scale of the inverse transform to the samples it keeps.
+template<typename FloatType, typename ProcessorType>
+struct OverlapSaveProcessor
+{
+    using value_type     = FloatType;
+    using processor_type = ProcessorType;
+
+    OverlapSaveProcessor(std::uint32_t blockSize, std::uint32_t hopSize);
+
+    auto prepare(juce::dsp::ProcessSpec const& spec) -> void;
+
+    /// \brief Reserves the transform work memory on the calling thread.
+    /// prepare() does it on its own, call this once on the audio thread
+    /// before the first process() if prepare() ran on a different one.
+    auto reserveScratch() const -> void;
+
+    template<typename ProcessContext>
+    auto process(ProcessContext const& context) -> void;
+
+    auto reset() -> void;
+
+    [[nodiscard]] auto processor() noexcept -> ProcessorType&;
+    [[nodiscard]] auto processor() const noexcept -> ProcessorType const&;
+
+private:
+    auto pushInput(std::uint32_t channel, FloatType const* samples, std::uint32_t numSamples) -> void;
+    auto popOutput(std::uint32_t channel, FloatType* samples, std::uint32_t numSamples) -> void;
+    auto processWrapped() -> void;
+    auto frame(std::uint32_t channel) -> FloatType*;
+
+    static constexpr auto isSpectral = SpectralProcessor<ProcessorType, FloatType>;
+
+    ProcessorType _processor;
+
+    std::vector<MirroredCircularBuffer<value_type>> _inputBuffers{};
+    juce::AudioBuffer<value_type> _processBuffer{};
+
+    std::unique_ptr<pffft::Fft<value_type>> _fft{};
+    pffft::AlignedVector<value_type> _frames{};
+    pffft::AlignedVector<value_type> _spectrum{};
+
+    std::uint32_t _blockSize;
+    std::uint32_t _hopSize;
+    std::uint32_t _samplesSinceLastHop{0};
+    std::uint32_t _numChannels{0};
+};
+
+template<typename FloatType, typename ProcessorType>
+OverlapSaveProcessor<FloatType, ProcessorType>::OverlapSaveProcessor(std::uint32_t blockSize, std::uint32_t hopSize)
+    : _blockSize{blockSize}, _hopSize{hopSize}
+{
+    jassert(hopSize <= blockSize);
+
+    if constexpr (isSpectral)
+    {
+        _fft = std::make_unique<pffft::Fft<value_type>>(signCast<int>(blockSize));
+        jassert(_fft->isValid());
+        _spectrum = _fft->internalLayoutVector();
+    }
+}
+
+template<typename FloatType, typename ProcessorType>
+auto OverlapSaveProcessor<FloatType, ProcessorType>::prepare(juce::dsp::ProcessSpec const& spec) -> void
+{
+    _numChannels = spec.numChannels;
+    _inputBuffers.resize(_numChannels);
+    for (auto& buffer : _inputBuffers) { buffer = MirroredCircularBuffer<value_type>{_blockSize}; }
+
+    auto blockSpec             = spec;
+    blockSpec.maximumBlockSize = _blockSize;
+    _processor.prepare(blockSpec);
+
+    if constexpr (isSpectral)
+    {
+        _frames.assign(static_cast<std::size_t>(_numChannels) * _blockSize, FloatType{});
+    }
+    else
+    {
+        _processBuffer.setSize(signCast<int>(_numChannels), signCast<int>(_blockSize), false, true);
+        _processBuffer.clear();
+    }
+
+    reserveScratch();
+}
+
+template<typename FloatType, typename ProcessorType>
+auto OverlapSaveProcessor<FloatType, ProcessorType>::reserveScratch() const -> void
+{
+    if constexpr (isSpectral) { _fft->reserveScratch(); }
+}
+
+template<typename FloatType, typename ProcessorType>
+template<typename ProcessContext>
+auto OverlapSaveProcessor<FloatType, ProcessorType>::process(ProcessContext const& context) -> void
+{
+    static_assert(std::is_same_v<FloatType, typename ProcessContext::SampleType>);
+
+    auto inBlock  = context.getInputBlock();
+    auto outBlock = context.getOutputBlock();
+
+    jassert(inBlock.getNumChannels() == outBlock.getNumChannels());
+    jassert(inBlock.getNumSamples() == outBlock.getNumSamples());
+
+    auto const numSamples  = narrowCast<std::uint32_t>(inBlock.getNumSamples());
+    auto const numChannels = narrowCast<std::uint32_t>(inBlock.getNumChannels());
+
+    for (auto first{0U}; first < numSamples;)
+    {
+        auto const count = std::min(numSamples - first, _hopSize - _samplesSinceLastHop);
+
+        for (auto ch{0U}; ch < numChannels; ++ch)
+        {
+            pushInput(ch, std::next(inBlock.getChannelPointer(ch), first), count);
+            popOutput(ch, std::next(outBlock.getChannelPointer(ch), first), count);
+        }
+
+        first += count;
+        _samplesSinceLastHop += count;
+
+        if (_samplesSinceLastHop == _hopSize)
+        {
+            _samplesSinceLastHop = 0;
+            processWrapped();
+        }
+    }
+}
+
+template<typename FloatType, typename ProcessorType>
+auto OverlapSaveProcessor<FloatType, ProcessorType>::reset() -> void
+{
+    _processor.reset();
+
+    for (auto& buffer : _inputBuffers) { std::fill(std::begin(buffer), std::end(buffer), FloatType{}); }
+    std::fill(std::begin(_frames), std::end(_frames), FloatType{});
+    _processBuffer.clear();
+    _samplesSinceLastHop = 0;
+}
+
+template<typename FloatType, typename ProcessorType>
+auto OverlapSaveProcessor<FloatType, ProcessorType>::processor() noexcept -> ProcessorType&
+{
+    return _processor;
+}
+
+template<typename FloatType, typename ProcessorType>
+auto OverlapSaveProcessor<FloatType, ProcessorType>::processor() const noexcept -> ProcessorType const&
+{
+    return _processor;
+}
+
+template<typename FloatType, typename ProcessorType>
+auto OverlapSaveProcessor<FloatType, ProcessorType>::pushInput(std::uint32_t channel, FloatType const* samples,
+                                                               std::uint32_t numSamples) -> void
+{
+    _inputBuffers[channel].write(Span<FloatType const>{samples, numSamples});
+}
+
+template<typename FloatType, typename ProcessorType>
+auto OverlapSaveProcessor<FloatType, ProcessorType>::popOutput(std::uint32_t channel, FloatType* samples,
+                                                               std::uint32_t numSamples) -> void
+{
+    // The valid part of the last block is its final hop, read in place.
+    auto const* tail = std::next(frame(channel), _blockSize - _hopSize + _samplesSinceLastHop);
+    std::copy(tail, std::next(tail, numSamples), samples);
+}
+
+template<typename FloatType, typename ProcessorType>
+auto OverlapSaveProcessor<FloatType, ProcessorType>::processWrapped() -> void
+{
+    auto const blockSize = signCast<int>(_blockSize);
+    for (auto ch{0U}; ch < _numChannels; ++ch)
+    {
+        auto const* input = _inputBuffers[ch].data();
+        juce::FloatVectorOperations::copy(frame(ch), input, blockSize);
+    }
+
+    if constexpr (isSpectral)
+    {
+        static constexpr auto const layout = ProcessorType::spectrumLayout;
+        using BinType                      = SpectrumValueType<value_type, layout>;
+
+        auto* const spectrum = _spectrum.data();
+        auto* const bins     = reinterpret_cast<BinType*>(spectrum);
+        auto const numBins   = _blockSize * sizeof(value_type) / sizeof(BinType);
+        auto const scale     = FloatType(1) / static_cast<FloatType>(_blockSize);
+
+        for (auto ch{0U}; ch < _numChannels; ++ch)
+        {
+            auto* const samples = frame(ch);
+            if constexpr (layout == SpectrumLayout::ordered)
+            {
+                _fft->forward(samples, bins);
+                _processor.processSpectrum(ch, Span<BinType>{bins, numBins});
+                _fft->inverse(bins, samples);
+            }
+            else
+            {
+                _fft->forwardToInternalLayout(samples, spectrum);
+                _processor.processSpectrum(ch, Span<BinType>{bins, numBins});
+                _fft->inverseFromInternalLayout(spectrum, samples);
+            }
+
+            // Only the kept samples need the inverse transform's scale.
+            auto* const tail = std::next(samples, _blockSize - _hopSize);
+            juce::FloatVectorOperations::multiply(tail, scale, signCast<int>(_hopSize));
+        }
+    }
+    else
+    {
+        auto block = juce::dsp::AudioBlock<value_type>(_processBuffer);
+        _processor.process(juce::dsp::ProcessContextReplacing<value_type>(block));
+    }
+}
+
+template<typename FloatType, typename ProcessorType>
+auto OverlapSaveProcessor<FloatType, ProcessorType>::frame(std::uint32_t channel) -> FloatType*
+{
+    if constexpr (isSpectral) { return _frames.data() + static_cast<std::size_t>(channel) * _blockSize; }
+    else { return _processBuffer.getWritePointer(signCast<int>(channel)); }
+}
+
+}  // namespace lt
\ No newline at end of file
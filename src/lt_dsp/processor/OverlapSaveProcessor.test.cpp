@@ -0,0 +1,129 @@
+#include <lt_dsp/convolution/DirectConvolution.test.hpp>
+#include <lt_dsp/lt_dsp.hpp>
+
+#include "catch2/catch_approx.hpp"
+#include "catch2/catch_template_test_macros.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+// Convolves every block on its own, only the tail is free of edge effects.
+template<typename T>
+struct BlockFirProcessor
+{
+    auto prepare(juce::dsp::ProcessSpec const& s) -> void { spec = s; }
+
+    template<typename ProcessContext>
+    auto process(ProcessContext const& context) -> void
+    {
+        auto&& block = context.getOutputBlock();
+        for (auto ch{0U}; ch < block.getNumChannels(); ++ch)
+        {
+            auto* samples     = block.getChannelPointer(ch);
+            auto const signal = std::vector<T>(samples, samples + block.getNumSamples());
+            auto const out    = directConvolution(signal, taps);
+            std::copy(std::cbegin(out), std::cend(out), samples);
+        }
+    }
+
+    auto reset() -> void {}
+
+    std::vector<T> taps{};
+    juce::dsp::ProcessSpec spec{};
+};
+
+template<typename T>
+struct SpectralFirProcessor
+{
+    static constexpr auto spectrumLayout = lt::SpectrumLayout::ordered;
+
+    auto prepare(juce::dsp::ProcessSpec const& spec) -> void
+    {
+        auto fft    = pffft::Fft<T>{static_cast<int>(spec.maximumBlockSize)};
+        auto padded = fft.valueVector();
+        std::fill(std::begin(padded), std::end(padded), T{});
+        std::copy(std::cbegin(taps), std::cend(taps), std::begin(padded));
+        filter = fft.spectrumVector();
+        fft.forward(padded, filter);
+    }
+
+    auto processSpectrum(std::uint32_t /*channel*/, lt::Span<std::complex<T>> bins) -> void
+    {
+        // Bin 0 holds the real dc and nyquist values.
+        bins[0] = {bins[0].real() * filter[0].real(), bins[0].imag() * filter[0].imag()};
+        for (auto i{1U}; i < std::size(bins); ++i) { bins[i] *= filter[i]; }
+    }
+
+    auto reset() -> void {}
+
+    std::vector<T> taps{};
+    pffft::AlignedVector<std::complex<T>> filter{};
+};
+
+template<typename Proc, typename T>
+static auto checkConvolution(Proc& proc, std::vector<T> const& taps) -> void
+{
+    static constexpr auto const numChannels    = 2U;
+    static constexpr auto const numSamples     = 1200U;
+    static constexpr auto const audioBlockSize = 37U;
+    static constexpr auto const hopSize        = 48U;
+
+    auto const signal = randomSignal<T>(numSamples, 7);
+    auto const expect = directConvolution(signal, taps);
+
+    proc.prepare(juce::dsp::ProcessSpec{44100.0, audioBlockSize, numChannels});
+
+    auto buffer = juce::AudioBuffer<T>{int(numChannels), int(numSamples)};
+    for (auto ch{0}; ch < int(numChannels); ++ch)
+    {
+        std::copy(std::cbegin(signal), std::cend(signal), buffer.getWritePointer(ch));
+    }
+
+    auto block = juce::dsp::AudioBlock<T>{buffer};
+    for (auto i{0U}; i < numSamples; i += audioBlockSize)
+    {
+        auto subBlock = block.getSubBlock(i, std::min(audioBlockSize, numSamples - i));
+        proc.process(juce::dsp::ProcessContextReplacing<T>{subBlock});
+    }
+
+    for (auto ch{0}; ch < int(numChannels); ++ch)
+    {
+        auto const* out = buffer.getReadPointer(ch);
+        for (auto i{0U}; i < hopSize; ++i) { REQUIRE(out[i] == Catch::Approx(0.0).margin(1e-5)); }
+        for (auto i{hopSize}; i < numSamples; ++i)
+        {
+            REQUIRE(out[i] == Catch::Approx(expect[i - hopSize]).margin(1e-4));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("dsp/processor: OverlapSaveProcessor", "[dsp][processor]", float, double)
+{
+    static constexpr auto const blockSize = 64U;
+    static constexpr auto const hopSize   = 48U;
+
+    // The longest filter that leaves hopSize samples free of aliasing.
+    auto const taps = randomSignal<TestType>(blockSize - hopSize + 1U, 3);
+
+    SECTION("time domain")
+    {
+        auto proc             = lt::OverlapSaveProcessor<TestType, BlockFirProcessor<TestType>>{blockSize, hopSize};
+        proc.processor().taps = taps;
+        checkConvolution(proc, taps);
+        REQUIRE(proc.processor().spec.maximumBlockSize == blockSize);
+    }
+
+    SECTION("spectral")
+    {
+        auto proc             = lt::OverlapSaveProcessor<TestType, SpectralFirProcessor<TestType>>{blockSize, hopSize};
+        proc.processor().taps = taps;
+        checkConvolution(proc, taps);
+    }
+
+    SECTION("reset")
+    {
+        auto proc             = lt::OverlapSaveProcessor<TestType, SpectralFirProcessor<TestType>>{blockSize, hopSize};
+        proc.processor().taps = taps;
+        checkConvolution(proc, taps);
+        proc.reset();
+        checkConvolution(proc, taps);
+    }
+}
\ No newline at end of file
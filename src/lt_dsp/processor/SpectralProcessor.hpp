@@ -0,0 +1,43 @@
+#pragma once
+
+#include <complex>
+#include <concepts>
+
+namespace lt
+{
+
+/// \brief Order of the bins handed to a SpectralProcessor.
+enum struct SpectrumLayout
+{
+    /// Canonical order, size / 2 complex bins. The real valued nyquist
+    /// bin is packed into the imaginary part of the dc bin.
+    ordered,
+
+    /// pffft's internal layout, size real values. Skips the reordering
+    /// pass, for processors that only apply per-bin operations or use
+    /// pffft's convolve functions.
+    internal,
+};
+
+/// \brief Value type of one element of the spectrum in the given layout.
+template<typename FloatType, SpectrumLayout Layout>
+using SpectrumValueType
+    = std::conditional_t<Layout == SpectrumLayout::ordered, std::complex<FloatType>, FloatType>;
+
+/// \brief A processor that works on the spectrum of each block instead
+/// of the time-domain samples.
+///
+/// \details When wrapped by OverlapAddProcessor, the wrapper owns the
+/// transform and its buffers. It calls processSpectrum once per channel
+/// and hop, with the bins of the windowed block in the layout declared
+/// by the processor's static spectrumLayout member. The bins are modified
+/// in place and the wrapper handles the inverse transform and scaling.
+template<typename ProcessorType, typename FloatType>
+concept SpectralProcessor = requires {
+    { ProcessorType::spectrumLayout } -> std::convertible_to<SpectrumLayout>;
+} && requires(ProcessorType& processor, std::uint32_t channel,
+              Span<SpectrumValueType<FloatType, ProcessorType::spectrumLayout>> bins) {
+    processor.processSpectrum(channel, bins);
+};
+
+}  // namespace lt
\ No newline at end of file
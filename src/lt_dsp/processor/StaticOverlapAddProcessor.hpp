@@ -0,0 +1,317 @@
+#pragma once
+
+#include <array>
+
+namespace lt
+{
+
+/// \brief OverlapAddProcessor with the block size, hop size and channel
+/// count fixed at compile time.
+///
+/// \details Same staging, windowing and spectral processor support as
+/// OverlapAddProcessor, without batching or worker threads. All buffers
+/// are stored inline, so every loop over a block or over the channels
+/// has a constant trip count the compiler can unroll and vectorize, and
+/// the hot path has no casts or size checks. The object holds several
+/// blocks per channel and should live on the heap for large blocks.
+template<typename FloatType, typename ProcessorType, std::uint32_t BlockSize, std::uint32_t HopSize,
+         std::uint32_t NumChannels>
+struct StaticOverlapAddProcessor
+{
+    static_assert(HopSize > 0U && HopSize < BlockSize);
+    static_assert(NumChannels > 0U);
+
+    using value_type     = FloatType;
+    using processor_type = ProcessorType;
+
+    static constexpr auto blockSize   = BlockSize;
+    static constexpr auto hopSize     = HopSize;
+    static constexpr auto numChannels = NumChannels;
+
+    StaticOverlapAddProcessor();
+
+    auto prepare(juce::dsp::ProcessSpec const& spec) -> void;
+
+    /// \brief Reserves the transform work memory on the calling thread.
+    /// prepare() does it on its own, call this once on the audio thread
+    /// before the first process() if prepare() ran on a different one.
+    auto reserveScratch() const -> void;
+
+    template<typename ProcessContext>
+    auto process(ProcessContext const& context) -> void;
+
+    auto reset() -> void;
+
+    auto setAnalysisWindow(WindowType type, FloatType kaiserBeta = FloatType(8)) -> void;
+    auto setSynthesisWindow(WindowType type, FloatType kaiserBeta = FloatType(8)) -> void;
+
+    [[nodiscard]] auto analysisWindow() const noexcept -> Span<FloatType const>;
+    [[nodiscard]] auto synthesisWindow() const noexcept -> Span<FloatType const>;
+
+    [[nodiscard]] auto processor() noexcept -> ProcessorType&;
+    [[nodiscard]] auto processor() const noexcept -> ProcessorType const&;
+
+private:
+    template<std::size_t Size>
+    using Block = std::array<FloatType, Size>;
+
+    auto processWrapped() -> void;
+    auto updateSynthesisTable() -> void;
+
+    static constexpr auto isSpectral = SpectralProcessor<ProcessorType, FloatType>;
+
+    ProcessorType _processor;
+    std::unique_ptr<pffft::Fft<value_type>> _fft{};
+
+    alignas(64) std::array<Block<BlockSize * 2U>, NumChannels> _inputBuffers{};
+    alignas(64) std::array<Block<BlockSize>, NumChannels> _outputBuffers{};
+    alignas(64) std::array<Block<BlockSize>, NumChannels> _frames{};
+    alignas(64) Block<BlockSize> _spectrum{};
+
+    alignas(64) Block<BlockSize> _analysisWindow{};
+    alignas(64) Block<BlockSize> _synthesisWindow{};
+    alignas(64) Block<BlockSize> _synthesisTable{};
+
+    std::uint32_t _samplesSinceLastHop{0};
+    std::uint32_t _inputWritePosition{0};
+    std::uint32_t _outputReadPosition{0};
+};
+
+template<typename FloatType, typename ProcessorType, std::uint32_t BlockSize, std::uint32_t HopSize,
+         std::uint32_t NumChannels>
+StaticOverlapAddProcessor<FloatType, ProcessorType, BlockSize, HopSize, NumChannels>::StaticOverlapAddProcessor()
+{
+    if constexpr (isSpectral)
+    {
+        _fft = std::make_unique<pffft::Fft<value_type>>(static_cast<int>(BlockSize));
+        jassert(_fft->isValid());
+    }
+
+    _analysisWindow.fill(FloatType(1));
+    _synthesisWindow.fill(FloatType(1));
+    updateSynthesisTable();
+}
+
+template<typename FloatType, typename ProcessorType, std::uint32_t BlockSize, std::uint32_t HopSize,
+         std::uint32_t NumChannels>
+auto StaticOverlapAddProcessor<FloatType, ProcessorType, BlockSize, HopSize, NumChannels>::prepare(
+    juce::dsp::ProcessSpec const& spec) -> void
+{
+    jassert(spec.numChannels == NumChannels);
+
+    auto blockSpec             = spec;
+    blockSpec.maximumBlockSize = BlockSize;
+    _processor.prepare(blockSpec);
+
+    reset();
+    reserveScratch();
+}
+
+template<typename FloatType, typename ProcessorType, std::uint32_t BlockSize, std::uint32_t HopSize,
+         std::uint32_t NumChannels>
+auto StaticOverlapAddProcessor<FloatType, ProcessorType, BlockSize, HopSize, NumChannels>::reserveScratch() const
+    -> void
+{
+    if constexpr (isSpectral) { _fft->reserveScratch(); }
+}
+
+template<typename FloatType, typename ProcessorType, std::uint32_t BlockSize, std::uint32_t HopSize,
+         std::uint32_t NumChannels>
+template<typename ProcessContext>
+auto StaticOverlapAddProcessor<FloatType, ProcessorType, BlockSize, HopSize, NumChannels>::process(
+    ProcessContext const& context) -> void
+{
+    static_assert(std::is_same_v<FloatType, typename ProcessContext::SampleType>);
+
+    auto inBlock  = context.getInputBlock();
+    auto outBlock = context.getOutputBlock();
+
+    jassert(inBlock.getNumChannels() == NumChannels);
+    jassert(outBlock.getNumChannels() == NumChannels);
+    jassert(inBlock.getNumSamples() == outBlock.getNumSamples());
+
+    auto const numSamples = inBlock.getNumSamples();
+
+    for (std::size_t first{0}; first < numSamples;)
+    {
+        auto const count = std::min<std::size_t>(numSamples - first, HopSize - _samplesSinceLastHop);
+
+        // At most one wrap in either ring, since count never exceeds HopSize.
+        auto const inFirst  = std::min<std::size_t>(count, BlockSize - _inputWritePosition);
+        auto const outStart = (_outputReadPosition + _samplesSinceLastHop) % BlockSize;
+        auto const outFirst = std::min<std::size_t>(count, BlockSize - outStart);
+
+        for (auto ch{0U}; ch < NumChannels; ++ch)
+        {
+            auto const* in = inBlock.getChannelPointer(ch) + first;
+            auto* input    = _inputBuffers[ch].data();
+            std::copy_n(in, inFirst, input + _inputWritePosition);
+            std::copy_n(in, inFirst, input + _inputWritePosition + BlockSize);
+            std::copy_n(in + inFirst, count - inFirst, input);
+            std::copy_n(in + inFirst, count - inFirst, input + BlockSize);
+
+            auto* out    = outBlock.getChannelPointer(ch) + first;
+            auto* output = _outputBuffers[ch].data();
+            std::copy_n(output + outStart, outFirst, out);
+            std::copy_n(output, count - outFirst, out + outFirst);
+            std::fill_n(output + outStart, outFirst, FloatType{});
+            std::fill_n(output, count - outFirst, FloatType{});
+        }
+
+        first += count;
+        _samplesSinceLastHop += static_cast<std::uint32_t>(count);
+        _inputWritePosition = static_cast<std::uint32_t>((_inputWritePosition + count) % BlockSize);
+
+        if (_samplesSinceLastHop == HopSize)
+        {
+            _samplesSinceLastHop = 0;
+            processWrapped();
+        }
+    }
+}
+
+template<typename FloatType, typename ProcessorType, std::uint32_t BlockSize, std::uint32_t HopSize,
+         std::uint32_t NumChannels>
+auto StaticOverlapAddProcessor<FloatType, ProcessorType, BlockSize, HopSize, NumChannels>::reset() -> void
+{
+    _processor.reset();
+
+    for (auto& buffer : _inputBuffers) { buffer.fill(FloatType{}); }
+    for (auto& buffer : _outputBuffers) { buffer.fill(FloatType{}); }
+    _samplesSinceLastHop = 0;
+    _inputWritePosition  = 0;
+    _outputReadPosition  = 0;
+}
+
+template<typename FloatType, typename ProcessorType, std::uint32_t BlockSize, std::uint32_t HopSize,
+         std::uint32_t NumChannels>
+auto StaticOverlapAddProcessor<FloatType, ProcessorType, BlockSize, HopSize, NumChannels>::setAnalysisWindow(
+    WindowType type, FloatType kaiserBeta) -> void
+{
+    fillWindow(Span<FloatType>{_analysisWindow}, type, kaiserBeta);
+    updateSynthesisTable();
+}
+
+template<typename FloatType, typename ProcessorType, std::uint32_t BlockSize, std::uint32_t HopSize,
+         std::uint32_t NumChannels>
+auto StaticOverlapAddProcessor<FloatType, ProcessorType, BlockSize, HopSize, NumChannels>::setSynthesisWindow(
+    WindowType type, FloatType kaiserBeta) -> void
+{
+    fillWindow(Span<FloatType>{_synthesisWindow}, type, kaiserBeta);
+    updateSynthesisTable();
+}
+
+template<typename FloatType, typename ProcessorType, std::uint32_t BlockSize, std::uint32_t HopSize,
+         std::uint32_t NumChannels>
+auto StaticOverlapAddProcessor<FloatType, ProcessorType, BlockSize, HopSize, NumChannels>::analysisWindow()
+    const noexcept -> Span<FloatType const>
+{
+    return Span<FloatType const>{_analysisWindow};
+}
+
+template<typename FloatType, typename ProcessorType, std::uint32_t BlockSize, std::uint32_t HopSize,
+         std::uint32_t NumChannels>
+auto StaticOverlapAddProcessor<FloatType, ProcessorType, BlockSize, HopSize, NumChannels>::synthesisWindow()
+    const noexcept -> Span<FloatType const>
+{
+    return Span<FloatType const>{_synthesisWindow};
+}
+
+template<typename FloatType, typename ProcessorType, std::uint32_t BlockSize, std::uint32_t HopSize,
+         std::uint32_t NumChannels>
+auto StaticOverlapAddProcessor<FloatType, ProcessorType, BlockSize, HopSize, NumChannels>::processor() noexcept
+    -> ProcessorType&
+{
+    return _processor;
+}
+
+template<typename FloatType, typename ProcessorType, std::uint32_t BlockSize, std::uint32_t HopSize,
+         std::uint32_t NumChannels>
+auto StaticOverlapAddProcessor<FloatType, ProcessorType, BlockSize, HopSize, NumChannels>::processor() const noexcept
+    -> ProcessorType const&
+{
+    return _processor;
+}
+
+template<typename FloatType, typename ProcessorType, std::uint32_t BlockSize, std::uint32_t HopSize,
+         std::uint32_t NumChannels>
+auto StaticOverlapAddProcessor<FloatType, ProcessorType, BlockSize, HopSize, NumChannels>::processWrapped() -> void
+{
+    auto const* analysis = _analysisWindow.data();
+    for (auto ch{0U}; ch < NumChannels; ++ch)
+    {
+        auto const* input = _inputBuffers[ch].data() + _inputWritePosition;
+        auto* frame       = _frames[ch].data();
+        for (std::size_t i{0}; i < BlockSize; ++i) { frame[i] = input[i] * analysis[i]; }
+    }
+
+    if constexpr (isSpectral)
+    {
+        static constexpr auto const layout  = ProcessorType::spectrumLayout;
+        using BinType                       = SpectrumValueType<value_type, layout>;
+        static constexpr auto const numBins = BlockSize * sizeof(value_type) / sizeof(BinType);
+
+        auto* const spectrum = _spectrum.data();
+        auto* const bins     = reinterpret_cast<BinType*>(spectrum);
+
+        for (auto ch{0U}; ch < NumChannels; ++ch)
+        {
+            auto* const frame = _frames[ch].data();
+            if constexpr (layout == SpectrumLayout::ordered)
+            {
+                _fft->forward(frame, bins);
+                _processor.processSpectrum(ch, Span<BinType>{bins, numBins});
+                _fft->inverse(bins, frame);
+            }
+            else
+            {
+                _fft->forwardToInternalLayout(frame, spectrum);
+                _processor.processSpectrum(ch, Span<BinType>{bins, numBins});
+                _fft->inverseFromInternalLayout(spectrum, frame);
+            }
+        }
+    }
+    else
+    {
+        auto channels = std::array<FloatType*, NumChannels>{};
+        for (auto ch{0U}; ch < NumChannels; ++ch) { channels[ch] = _frames[ch].data(); }
+
+        auto block = juce::dsp::AudioBlock<value_type>{channels.data(), NumChannels, BlockSize};
+        _processor.process(juce::dsp::ProcessContextReplacing<value_type>{block});
+    }
+
+    // The first hop of the ring has been read and cleared, it becomes
+    // the end of the new frame.
+    _outputReadPosition = (_outputReadPosition + HopSize) % BlockSize;
+
+    auto const position   = _outputReadPosition;
+    auto const first      = BlockSize - position;
+    auto const* synthesis = _synthesisTable.data();
+    for (auto ch{0U}; ch < NumChannels; ++ch)
+    {
+        auto const* frame = _frames[ch].data();
+        auto* output      = _outputBuffers[ch].data();
+        auto* const head  = output + position;
+        auto const* tail  = frame + first;
+        auto const* table = synthesis + first;
+        for (std::size_t i{0}; i < first; ++i) { head[i] += frame[i] * synthesis[i]; }
+        for (std::size_t i{0}; i < position; ++i) { output[i] += tail[i] * table[i]; }
+    }
+}
+
+template<typename FloatType, typename ProcessorType, std::uint32_t BlockSize, std::uint32_t HopSize,
+         std::uint32_t NumChannels>
+auto StaticOverlapAddProcessor<FloatType, ProcessorType, BlockSize, HopSize, NumChannels>::updateSynthesisTable()
+    -> void
+{
+    auto const analysis  = Span<FloatType const>{_analysisWindow};
+    auto const synthesis = Span<FloatType const>{_synthesisWindow};
+    auto gain            = overlapAddGain(analysis, synthesis, HopSize);
+
+    // The inverse transform is unscaled.
+    if constexpr (isSpectral) { gain /= static_cast<FloatType>(BlockSize); }
+
+    for (auto i{0U}; i < BlockSize; ++i) { _synthesisTable[i] = _synthesisWindow[i] * gain; }
+}
+
+}  // namespace lt
\ No newline at end of file
@@ -0,0 +1,110 @@
+#include <lt_dsp/lt_dsp.hpp>
+
+#include "catch2/catch_approx.hpp"
+#include "catch2/catch_template_test_macros.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+struct StaticPassthroughProcessor
+{
+    auto prepare(juce::dsp::ProcessSpec const& s) -> void { spec = s; }
+
+    template<typename ProcessContext>
+    auto process(ProcessContext const& context) -> void
+    {
+        REQUIRE(context.getOutputBlock().getNumSamples() == spec.maximumBlockSize);
+    }
+
+    auto reset() -> void {}
+
+    juce::dsp::ProcessSpec spec{};
+};
+
+struct StaticSpectralProcessor
+{
+    static constexpr auto spectrumLayout = lt::SpectrumLayout::internal;
+
+    auto prepare(juce::dsp::ProcessSpec const& /*spec*/) -> void {}
+
+    template<typename T>
+    auto processSpectrum(std::uint32_t channel, lt::Span<T> bins) -> void
+    {
+        for (auto& bin : bins) { bin *= T(0.5) + T(channel); }
+    }
+
+    auto reset() -> void {}
+};
+
+template<typename Proc, typename T>
+static auto runProcessor(Proc& proc, std::uint32_t audioBlockSize) -> std::vector<T>
+{
+    static constexpr auto const numChannels = 2U;
+    static constexpr auto const numSamples  = 2000U;
+
+    proc.setAnalysisWindow(lt::WindowType::sqrtHann);
+    proc.setSynthesisWindow(lt::WindowType::sqrtHann);
+    proc.prepare(juce::dsp::ProcessSpec{44100.0, audioBlockSize, numChannels});
+
+    auto buffer = juce::AudioBuffer<T>{int(numChannels), int(numSamples)};
+    for (auto ch{0}; ch < int(numChannels); ++ch)
+    {
+        auto* data = buffer.getWritePointer(ch);
+        for (auto i{0U}; i < numSamples; ++i) { data[i] = std::sin(T(0.013) * T(i) * T(ch + 2)); }
+    }
+
+    auto block = juce::dsp::AudioBlock<T>{buffer};
+    for (auto i{0U}; i < numSamples; i += audioBlockSize)
+    {
+        auto subBlock = block.getSubBlock(i, std::min(audioBlockSize, numSamples - i));
+        proc.process(juce::dsp::ProcessContextReplacing<T>{subBlock});
+    }
+
+    auto out = std::vector<T>{};
+    for (auto ch{0}; ch < int(numChannels); ++ch)
+    {
+        std::copy(buffer.getReadPointer(ch), buffer.getReadPointer(ch) + numSamples, std::back_inserter(out));
+    }
+    return out;
+}
+
+TEMPLATE_TEST_CASE("dsp/processor: StaticOverlapAddProcessor", "[dsp][processor]", float, double)
+{
+    static constexpr auto const blockSize = 128U;
+    static constexpr auto const hopSize   = 32U;
+
+    auto const audioBlockSize = GENERATE(1U, 32U, 47U, 256U);
+
+    SECTION("time domain")
+    {
+        using Static  = lt::StaticOverlapAddProcessor<TestType, StaticPassthroughProcessor, blockSize, hopSize, 2U>;
+        using Dynamic = lt::OverlapAddProcessor<TestType, StaticPassthroughProcessor>;
+
+        STATIC_REQUIRE(Static::blockSize == blockSize);
+        STATIC_REQUIRE(Static::hopSize == hopSize);
+        STATIC_REQUIRE(Static::numChannels == 2U);
+
+        auto fixed   = std::make_unique<Static>();
+        auto dynamic = Dynamic{blockSize, hopSize};
+
+        auto const expected = runProcessor<Dynamic, TestType>(dynamic, audioBlockSize);
+        auto const actual   = runProcessor<Static, TestType>(*fixed, audioBlockSize);
+        REQUIRE(fixed->processor().spec.maximumBlockSize == blockSize);
+
+        REQUIRE(std::size(actual) == std::size(expected));
+        for (auto i{0U}; i < std::size(actual); ++i) { REQUIRE(actual[i] == Catch::Approx(expected[i]).margin(1e-6)); }
+    }
+
+    SECTION("spectral")
+    {
+        using Static  = lt::StaticOverlapAddProcessor<TestType, StaticSpectralProcessor, blockSize, hopSize, 2U>;
+        using Dynamic = lt::OverlapAddProcessor<TestType, StaticSpectralProcessor>;
+
+        auto fixed   = std::make_unique<Static>();
+        auto dynamic = Dynamic{blockSize, hopSize};
+
+        auto const expected = runProcessor<Dynamic, TestType>(dynamic, audioBlockSize);
+        auto const actual   = runProcessor<Static, TestType>(*fixed, audioBlockSize);
+
+        REQUIRE(std::size(actual) == std::size(expected));
+        for (auto i{0U}; i < std::size(actual); ++i) { REQUIRE(actual[i] == Catch::Approx(expected[i]).margin(1e-5)); }
+    }
+}
\ No newline at end of file
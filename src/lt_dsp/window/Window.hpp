@@ -0,0 +1,87 @@
+#pragma once
+
+namespace lt
+{
+
+/// \brief Window shapes with a built-in table generator.
+enum struct WindowType
+{
+    rectangular,
+    hann,
+    sqrtHann,
+    blackmanHarris,
+    kaiser,
+};
+
+/// \brief Zeroth order modified Bessel function of the first kind.
+template<typename T>
+[[nodiscard]] auto besselI0(T x) noexcept -> T
+{
+    // Power series, converges quickly for the beta range used by windows.
+    auto const halfX = x / T(2);
+    auto sum         = T(1);
+    auto term        = T(1);
+    for (auto k{1}; k < 64; ++k)
+    {
+        auto const factor = halfX / static_cast<T>(k);
+        term *= factor * factor;
+        sum += term;
+        if (term < sum * std::numeric_limits<T>::epsilon()) { break; }
+    }
+    return sum;
+}
+
+/// \brief Fills the span with a periodic window of the given type.
+///
+/// \details Periodic windows are the ones that sum to a constant when
+/// overlapped at hop sizes that divide the window length, which is
+/// what overlap-add processing needs. kaiserBeta is only used by the
+/// kaiser window.
+template<typename T>
+auto fillWindow(Span<T> window, WindowType type, T kaiserBeta = T(8)) -> void
+{
+    auto const size = static_cast<T>(std::size(window));
+    auto const pi   = juce::MathConstants<T>::pi;
+
+    auto index = T(0);
+    for (auto& sample : window)
+    {
+        auto const phase = T(2) * pi * index / size;
+        switch (type)
+        {
+            case WindowType::rectangular: sample = T(1); break;
+            case WindowType::hann: sample = T(0.5) - T(0.5) * std::cos(phase); break;
+            case WindowType::sqrtHann: sample = std::sqrt(T(0.5) - T(0.5) * std::cos(phase)); break;
+            case WindowType::blackmanHarris:
+                sample = T(0.35875) - T(0.48829) * std::cos(phase) + T(0.14128) * std::cos(T(2) * phase)
+                       - T(0.01168) * std::cos(T(3) * phase);
+                break;
+            case WindowType::kaiser:
+            {
+                auto const ratio = T(2) * index / size - T(1);
+                sample = besselI0(kaiserBeta * std::sqrt(std::max(T(0), T(1) - ratio * ratio))) / besselI0(kaiserBeta);
+                break;
+            }
+        }
+        index += T(1);
+    }
+}
+
+/// \brief Returns the gain that makes the overlapped product of the
+/// analysis and synthesis windows sum to one on average.
+template<typename T>
+[[nodiscard]] auto overlapAddGain(Span<T const> analysis, Span<T const> synthesis, std::size_t hopSize) -> T
+{
+    jassert(std::size(analysis) == std::size(synthesis));
+    jassert(hopSize > 0U);
+
+    auto sum = T(0);
+    for (auto i{0U}; i < std::size(analysis); ++i) { sum += analysis[i] * synthesis[i]; }
+
+    // Every output sample is covered by size / hop frames, so the mean
+    // overlap is the total window energy spread over one hop.
+    auto const mean = sum / static_cast<T>(hopSize);
+    return mean > T(0) ? T(1) / mean : T(0);
+}
+
+}  // namespace lt
\ No newline at end of file
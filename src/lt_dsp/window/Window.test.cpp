@@ -0,0 +1,78 @@
+#include <lt_dsp/lt_dsp.hpp>
+
+#include "catch2/catch_approx.hpp"
+#include "catch2/catch_template_test_macros.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+TEMPLATE_TEST_CASE("dsp/window: fillWindow", "[dsp][window]", float, double)
+{
+    auto window = std::vector<TestType>(16);
+    auto span   = lt::Span<TestType>{window};
+
+    SECTION("rectangular")
+    {
+        lt::fillWindow(span, lt::WindowType::rectangular);
+        REQUIRE(std::all_of(std::begin(window), std::end(window), [](auto s) { return s == TestType{1}; }));
+    }
+
+    SECTION("hann")
+    {
+        lt::fillWindow(span, lt::WindowType::hann);
+        REQUIRE(window[0] == Catch::Approx(0.0).margin(1e-6));
+        REQUIRE(window[8] == Catch::Approx(1.0));
+        REQUIRE(window[4] == Catch::Approx(0.5));
+        REQUIRE(window[4] == Catch::Approx(window[12]));
+    }
+
+    SECTION("sqrtHann")
+    {
+        lt::fillWindow(span, lt::WindowType::sqrtHann);
+        REQUIRE(window[8] == Catch::Approx(1.0));
+        REQUIRE(window[4] * window[4] == Catch::Approx(0.5));
+    }
+
+    SECTION("blackmanHarris")
+    {
+        lt::fillWindow(span, lt::WindowType::blackmanHarris);
+        REQUIRE(window[0] == Catch::Approx(0.00006).margin(1e-5));
+        REQUIRE(window[8] == Catch::Approx(1.0).margin(1e-5));
+    }
+
+    SECTION("kaiser")
+    {
+        lt::fillWindow(span, lt::WindowType::kaiser, TestType(8));
+        REQUIRE(window[8] == Catch::Approx(1.0));
+        REQUIRE(window[0] == Catch::Approx(1.0 / lt::besselI0(8.0)));
+        REQUIRE(window[3] == Catch::Approx(window[13]));
+    }
+}
+
+TEMPLATE_TEST_CASE("dsp/window: overlapAddGain", "[dsp][window]", float, double)
+{
+    auto analysis  = std::vector<TestType>(64);
+    auto synthesis = std::vector<TestType>(64);
+
+    SECTION("rectangular")
+    {
+        lt::fillWindow(lt::Span<TestType>{analysis}, lt::WindowType::rectangular);
+        lt::fillWindow(lt::Span<TestType>{synthesis}, lt::WindowType::rectangular);
+        auto const gain = lt::overlapAddGain(lt::Span<TestType const>{analysis}, lt::Span<TestType const>{synthesis}, 16U);
+        REQUIRE(gain == Catch::Approx(0.25));
+    }
+
+    SECTION("hann, rectangular")
+    {
+        lt::fillWindow(lt::Span<TestType>{analysis}, lt::WindowType::hann);
+        lt::fillWindow(lt::Span<TestType>{synthesis}, lt::WindowType::rectangular);
+        auto const gain = lt::overlapAddGain(lt::Span<TestType const>{analysis}, lt::Span<TestType const>{synthesis}, 32U);
+        REQUIRE(gain == Catch::Approx(1.0));
+    }
+
+    SECTION("sqrtHann, sqrtHann")
+    {
+        lt::fillWindow(lt::Span<TestType>{analysis}, lt::WindowType::sqrtHann);
+        lt::fillWindow(lt::Span<TestType>{synthesis}, lt::WindowType::sqrtHann);
+        auto const gain = lt::overlapAddGain(lt::Span<TestType const>{analysis}, lt::Span<TestType const>{synthesis}, 16U);
+        REQUIRE(gain == Catch::Approx(0.5));
+    }
+}
\ No newline at end of file